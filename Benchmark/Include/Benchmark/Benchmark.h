@@ -0,0 +1,257 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/CoreTypes.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if TDME_COMPILER_MSVC
+    #include <intrin.h>
+#endif
+
+namespace TDME
+{
+    namespace Benchmark
+    {
+        //////////////////////////////////////////////////////////////
+        // 최적화 방지 헬퍼
+        //////////////////////////////////////////////////////////////
+
+        namespace Detail
+        {
+            /**
+             * @brief 포인터를 외부로 노출하여 값 계산이 제거되지 않도록 함 (MSVC 용, 별도 번역 단위에 정의)
+             */
+            void UseCharPointer(const volatile char* pointer);
+        } // namespace Detail
+
+        /**
+         * @brief 컴파일러가 value 를 계산하는 코드를 제거하지 못하도록 함
+         * @param value 결과값
+         */
+        template <typename T>
+        FORCE_INLINE void DoNotOptimize(const T& value)
+        {
+#if TDME_COMPILER_MSVC
+            Detail::UseCharPointer(&reinterpret_cast<const volatile char&>(value));
+            _ReadWriteBarrier();
+#else
+            asm volatile("" : : "r,m"(value) : "memory");
+#endif
+        }
+
+        /**
+         * @brief 이전 메모리 쓰기가 제거되거나 재배치되지 않도록 함 (출력 배열에 쓰는 벤치마크용)
+         */
+        FORCE_INLINE void ClobberMemory()
+        {
+#if TDME_COMPILER_MSVC
+            _ReadWriteBarrier();
+#else
+            asm volatile("" : : : "memory");
+#endif
+        }
+
+        //////////////////////////////////////////////////////////////
+        // BenchmarkState
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 벤치마크 한 개의 측정 상태와 결과
+         * @details 벤치마크 함수는 준비 작업 후 Run() 에 측정할 본문을 한 번 전달.
+         *          Run() 은 한 샘플이 (MinTime / Repetitions) 이상 걸리도록 반복 횟수를 보정한 뒤 Repetitions 개의 샘플을 측정.
+         *          결과 검증에 실패하면 SkipWithError() 로 실패를 기록하며, 실패한 벤치마크가 있으면 실행 파일이 1 을 반환.
+         */
+        class BenchmarkState
+        {
+        public:
+            BenchmarkState(double minTimeSeconds, size_t repetitions)
+                : m_minTimeSeconds(minTimeSeconds), m_repetitions(repetitions) {}
+
+            /**
+             * @brief 본문을 반복 실행하며 시간 측정
+             * @param itemsPerCall 본문 한 번이 처리하는 연산 개수 (ns/op, ops/s 계산 기준)
+             * @param body 측정할 본문
+             */
+            template <typename Func>
+            void Run(size_t itemsPerCall, Func&& body)
+            {
+                m_itemsPerCall = itemsPerCall;
+
+                // 이미 실패했으면 측정하지 않음 (틀린 결과의 속도는 의미가 없음)
+                if (IsErrorOccurred())
+                    return;
+
+                // 1. 반복 횟수 보정 (워밍업 겸용)
+                const double targetSeconds = m_minTimeSeconds / double(m_repetitions);
+                size_t       iterations    = 1;
+                for (;;)
+                {
+                    const double elapsed = Measure(iterations, body);
+                    if (elapsed >= targetSeconds || iterations >= MaxIterations)
+                        break;
+
+                    // 목표 시간의 1.2배를 겨냥하되 한 번에 최대 10배까지만 증가
+                    const double scale = (elapsed > 0.0) ? std::min(10.0, targetSeconds * 1.2 / elapsed) : 10.0;
+                    iterations         = std::max(iterations + 1, size_t(double(iterations) * scale));
+                }
+                m_iterations = iterations;
+
+                // 2. 샘플 측정 (ns/op)
+                m_samples.clear();
+                for (size_t r = 0; r < m_repetitions; r++)
+                {
+                    const double elapsed = Measure(iterations, body);
+                    m_samples.push_back(elapsed * 1e9 / (double(iterations) * double(itemsPerCall)));
+                }
+            }
+
+            /**
+             * @brief 결과에 추가로 기록할 값 (정확도 오차, 가시 개수 등)
+             * @param name 이름
+             * @param value 값
+             */
+            void SetCounter(const std::string& name, double value)
+            {
+                m_counters.emplace_back(name, value);
+            }
+
+            /**
+             * @brief 벤치마크를 실패로 기록 (이후 Run() 은 측정하지 않음)
+             * @param message 실패 이유 (처음 기록한 것만 유지)
+             */
+            void SkipWithError(const std::string& message)
+            {
+                if (!IsErrorOccurred())
+                {
+                    m_errorMessage = message;
+                }
+            }
+
+            /**
+             * @brief 오차를 카운터로 기록하고, 허용 오차를 넘으면(또는 NaN 이면) 실패로 기록
+             * @param name 카운터 이름
+             * @param error 측정한 오차
+             * @param tolerance 허용 오차 (측정 대상 함수의 문서에 적힌 값)
+             * @return bool 허용 오차 이내 여부
+             */
+            bool CheckError(const std::string& name, double error, double tolerance)
+            {
+                SetCounter(name, error);
+                if (error <= tolerance)
+                    return true;
+
+                char buffer[128];
+                std::snprintf(buffer, sizeof(buffer), "%s=%g exceeds tolerance %g", name.c_str(), error, tolerance);
+                SkipWithError(buffer);
+                return false;
+            }
+
+            //////////////////////////////////////////////////////////////
+            // Getter
+            //////////////////////////////////////////////////////////////
+
+            size_t                                             GetIterations() const { return m_iterations; }
+            size_t                                             GetItemsPerCall() const { return m_itemsPerCall; }
+            const std::vector<double>&                         GetSamples() const { return m_samples; }
+            const std::vector<std::pair<std::string, double>>& GetCounters() const { return m_counters; }
+            const std::string&                                 GetErrorMessage() const { return m_errorMessage; }
+            bool                                               IsErrorOccurred() const { return !m_errorMessage.empty(); }
+
+        private:
+            static constexpr size_t MaxIterations = size_t(1) << 30;
+
+            template <typename Func>
+            static double Measure(size_t iterations, Func& body)
+            {
+                using Clock = std::chrono::steady_clock;
+
+                const Clock::time_point start = Clock::now();
+                for (size_t i = 0; i < iterations; i++)
+                {
+                    body();
+                }
+                return std::chrono::duration<double>(Clock::now() - start).count();
+            }
+
+            double m_minTimeSeconds;
+            size_t m_repetitions;
+            size_t m_iterations   = 0;
+            size_t m_itemsPerCall = 1;
+
+            std::vector<double>                         m_samples;
+            std::vector<std::pair<std::string, double>> m_counters;
+            std::string                                 m_errorMessage; // 비어 있으면 성공
+        };
+
+        //////////////////////////////////////////////////////////////
+        // 등록
+        //////////////////////////////////////////////////////////////
+
+        using BenchmarkFunction = void (*)(BenchmarkState&);
+
+        /**
+         * @brief 등록된 벤치마크 정보
+         */
+        struct BenchmarkInfo
+        {
+            std::string       Category;
+            std::string       Name;
+            BenchmarkFunction Function;
+
+            /**
+             * @brief "Category/Name" 형식의 전체 이름
+             */
+            std::string GetFullName() const { return Category + "/" + Name; }
+        };
+
+        /**
+         * @brief 벤치마크 등록소 (TDME_BENCHMARK 매크로가 정적 초기화 시점에 등록)
+         */
+        class BenchmarkRegistry
+        {
+        public:
+            static BenchmarkRegistry& Get();
+
+            void Register(const char* category, const char* name, BenchmarkFunction function);
+
+            const std::vector<BenchmarkInfo>& GetBenchmarks() const { return m_benchmarks; }
+
+        private:
+            std::vector<BenchmarkInfo> m_benchmarks;
+        };
+
+        /**
+         * @brief 정적 객체 생성자에서 벤치마크를 등록하기 위한 헬퍼
+         */
+        struct BenchmarkRegistrar
+        {
+            BenchmarkRegistrar(const char* category, const char* name, BenchmarkFunction function)
+            {
+                BenchmarkRegistry::Get().Register(category, name, function);
+            }
+        };
+    } // namespace Benchmark
+} // namespace TDME
+
+/**
+ * @brief 벤치마크 함수 정의 및 등록
+ * @details 사용 예)
+ * @code
+ * TDME_BENCHMARK(Matrix, Multiply)
+ * {
+ *     // 준비
+ *     state.Run(count, [&] { ... });
+ * }
+ * @endcode
+ */
+#define TDME_BENCHMARK(category, name)                                                           \
+    static void Benchmark_##category##_##name(::TDME::Benchmark::BenchmarkState& state);         \
+    static const ::TDME::Benchmark::BenchmarkRegistrar s_benchmarkRegistrar_##category##_##name( \
+        #category, #name, &Benchmark_##category##_##name);                                       \
+    static void Benchmark_##category##_##name(::TDME::Benchmark::BenchmarkState& state)
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/CoreTypes.h"
+#include "Core/Math/MathConstants.h"
+#include "Core/Math/TQuaternion.h"
+#include "Core/Math/TVector2.h"
+#include "Core/Math/TVector3.h"
+#include "Core/Math/TVector4.h"
+#include "Core/Math/Transform.h"
+
+#include <random>
+#include <vector>
+
+namespace TDME
+{
+    namespace Benchmark
+    {
+        /**
+         * @brief 배열 벤치마크의 기본 요소 개수
+         * @details 입력/출력 배열이 L1~L2 캐시에 머무는 크기 (Vector3 1024개 = 12KB)
+         */
+        INLINE constexpr size_t DefaultBatchSize = 1024;
+
+        /**
+         * @brief 벤치마크 입력 데이터 생성기
+         * @details 고정 시드를 사용하므로 실행할 때마다 같은 데이터를 생성 (실행 간 결과 비교용)
+         */
+        class BenchmarkRandom
+        {
+        public:
+            explicit BenchmarkRandom(uint32 seed = 12345) : m_engine(seed) {}
+
+            float NextFloat(float min, float max)
+            {
+                return std::uniform_real_distribution<float>(min, max)(m_engine);
+            }
+
+            Vector2 NextVector2(float min, float max)
+            {
+                return Vector2(NextFloat(min, max), NextFloat(min, max));
+            }
+
+            Vector3 NextVector3(float min, float max)
+            {
+                return Vector3(NextFloat(min, max), NextFloat(min, max), NextFloat(min, max));
+            }
+
+            Vector4 NextVector4(float min, float max)
+            {
+                return Vector4(NextFloat(min, max), NextFloat(min, max), NextFloat(min, max), NextFloat(min, max));
+            }
+
+            /**
+             * @brief 임의의 단위 쿼터니언
+             */
+            Quaternion NextUnitQuaternion()
+            {
+                Quaternion q(NextFloat(-1.0f, 1.0f), NextFloat(-1.0f, 1.0f), NextFloat(-1.0f, 1.0f), NextFloat(-1.0f, 1.0f));
+                q.Normalize();
+                return q;
+            }
+
+            /**
+             * @brief 임의의 TRS 트랜스폼 (스케일은 양수)
+             */
+            Transform NextTransform()
+            {
+                return Transform(NextVector3(-100.0f, 100.0f), NextUnitQuaternion(), NextVector3(0.5f, 2.0f));
+            }
+
+            /**
+             * @brief generator 를 count 번 호출하여 배열 생성
+             */
+            template <typename Func>
+            auto Generate(size_t count, Func&& generator) -> std::vector<decltype(generator())>
+            {
+                std::vector<decltype(generator())> result;
+                result.reserve(count);
+                for (size_t i = 0; i < count; i++)
+                {
+                    result.push_back(generator());
+                }
+                return result;
+            }
+
+        private:
+            std::mt19937 m_engine;
+        };
+    } // namespace Benchmark
+} // namespace TDME
\ No newline at end of file
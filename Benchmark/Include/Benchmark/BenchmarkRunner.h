@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Benchmark/Benchmark.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace TDME
+{
+    namespace Benchmark
+    {
+        /**
+         * @brief 실행 옵션 (명령줄 인자에서 설정)
+         */
+        struct BenchmarkOptions
+        {
+            std::string Filter;                 // 전체 이름("Category/Name")에 포함되어야 하는 문자열 (비어 있으면 전체 실행)
+            std::string JsonPath;               // JSON 결과 파일 경로 (비어 있으면 출력하지 않음)
+            double      MinTimeSeconds = 0.5;   // 벤치마크 하나당 측정 시간 (초)
+            size_t      Repetitions    = 5;     // 샘플 개수 (중앙값 보고)
+            bool        ListOnly       = false; // 실행하지 않고 이름만 출력
+        };
+
+        /**
+         * @brief 벤치마크 한 개의 결과
+         * @details ns/op 통계는 샘플별 값으로 계산하며 대표값은 중앙값
+         */
+        struct BenchmarkResult
+        {
+            std::string Category;
+            std::string Name;
+            size_t      Iterations    = 0;   // 샘플 하나당 본문 반복 횟수
+            size_t      ItemsPerCall  = 0;   // 본문 한 번이 처리하는 연산 개수
+            double      NsPerOp       = 0.0; // 중앙값
+            double      NsPerOpMin    = 0.0;
+            double      NsPerOpMean   = 0.0;
+            double      NsPerOpStdDev = 0.0;
+            double      OpsPerSecond  = 0.0; // 1e9 / NsPerOp
+
+            std::vector<std::pair<std::string, double>> Counters;
+            std::string                                 ErrorMessage; // BenchmarkState::SkipWithError 로 기록한 실패 이유 (비어 있으면 성공)
+        };
+
+        /**
+         * @brief 등록된 벤치마크를 실행하고 결과를 콘솔/JSON 으로 출력
+         */
+        class BenchmarkRunner
+        {
+        public:
+            explicit BenchmarkRunner(const BenchmarkOptions& options);
+
+            /**
+             * @brief 필터에 맞는 벤치마크를 카테고리, 이름 순으로 정렬하여 실행
+             * @return std::vector<BenchmarkResult> 결과 목록
+             */
+            std::vector<BenchmarkResult> RunAll() const;
+
+            /**
+             * @brief 필터에 맞는 벤치마크 이름 목록 출력
+             */
+            void PrintList() const;
+
+            /**
+             * @brief 결과 표를 콘솔에 출력
+             * @param results 결과 목록
+             */
+            static void PrintTable(const std::vector<BenchmarkResult>& results);
+
+            /**
+             * @brief 결과를 JSON 파일로 저장 (실행 환경 정보 포함)
+             * @param path 파일 경로
+             * @param results 결과 목록
+             * @return bool 저장 성공 여부
+             */
+            static bool WriteJson(const std::string& path, const std::vector<BenchmarkResult>& results);
+
+            /**
+             * @brief 실패한 벤치마크 개수 반환
+             * @param results 결과 목록
+             */
+            static size_t CountErrors(const std::vector<BenchmarkResult>& results);
+
+        private:
+            std::vector<BenchmarkInfo> GetFilteredBenchmarks() const;
+
+            BenchmarkOptions m_options;
+        };
+    } // namespace Benchmark
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include <Core/Async/JobSystem.h>
+#include <Core/Geometry/TFrustum.h>
+#include <Core/Math/Projections.h>
+#include <Core/Math/Transformations.h>
+
+#include <cmath>
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    constexpr uint32 ComputeItemCount    = 1 << 20; // ParallelFor 항목 수
+    constexpr uint32 UnevenItemCount     = 1 << 16; // 비용이 고르지 않은 항목 수
+    constexpr uint32 CullingBoundsCount  = 1000000; // 병렬 컬링하는 경계 구 수
+    constexpr uint32 CullingBlockSize    = 1024;    // 컬링 작업 하나가 처리하는 경계 구 수 (마스크 바이트 경계에 맞도록 8 의 배수)
+    constexpr uint32 EmptyJobCount       = 1024;    // 한 번에 넣는 빈 작업 수
+    constexpr uint32 OverheadWorkerCount = 3;       // 작업 오버헤드 측정에 사용하는 작업 스레드 수
+
+    /**
+     * @brief 항목 하나의 계산 (초월 함수 몇 번, 메모리 접근 없음)
+     */
+    float ComputeItem(uint32 index, uint32 iterationCount)
+    {
+        float value = static_cast<float>(index) * 0.001f;
+        for (uint32 i = 0; i < iterationCount; i++)
+        {
+            value = std::sqrt(value * value + 1.0f) + std::sin(value);
+        }
+        return value;
+    }
+
+    /**
+     * @brief 작업 스레드 workerCount 개(+ 메인 스레드)로 고른 비용의 항목 1M 개를 ParallelFor (자동 구간 크기)
+     */
+    void RunParallelCompute(BenchmarkState& state, uint32 workerCount)
+    {
+        JobSystem          jobSystem(workerCount);
+        std::vector<float> output(ComputeItemCount);
+
+        state.Run(ComputeItemCount, [&] {
+            jobSystem.ParallelFor(ComputeItemCount, 0, [&](uint32 begin, uint32 end) {
+                for (uint32 i = begin; i < end; i++)
+                {
+                    output[i] = ComputeItem(i, 4);
+                }
+            });
+            DoNotOptimize(output.data());
+            ClobberMemory();
+        });
+
+        state.SetCounter("Threads", double(jobSystem.GetThreadCount()));
+    }
+
+    /**
+     * @brief 항목 인덱스에 비례하여 비용이 커지는 항목을 ParallelFor (뒤쪽 구간이 무거우므로 훔치기로 부하가 분산되어야 함)
+     */
+    void RunParallelUneven(BenchmarkState& state, uint32 workerCount)
+    {
+        JobSystem          jobSystem(workerCount);
+        std::vector<float> output(UnevenItemCount);
+
+        state.Run(UnevenItemCount, [&] {
+            jobSystem.ParallelFor(UnevenItemCount, 0, [&](uint32 begin, uint32 end) {
+                for (uint32 i = begin; i < end; i++)
+                {
+                    output[i] = ComputeItem(i, 1 + i / 1024);
+                }
+            });
+            DoNotOptimize(output.data());
+            ClobberMemory();
+        });
+
+        state.SetCounter("Threads", double(jobSystem.GetThreadCount()));
+    }
+
+    /**
+     * @brief 경계 구 1M 개를 블록 단위로 나누어 병렬 절두체 컬링 (블록마다 배치 CullSpheres)
+     */
+    void RunParallelCulling(BenchmarkState& state, uint32 workerCount)
+    {
+        BenchmarkRandom random;
+
+        const Matrix  view       = LookAtLH(Vector3(0.0f, 50.0f, -300.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+        const Matrix  projection = PerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+        const Frustum frustum(view * projection);
+
+        const std::vector<float> centerX = random.Generate(CullingBoundsCount, [&] { return random.NextFloat(-500.0f, 500.0f); });
+        const std::vector<float> centerY = random.Generate(CullingBoundsCount, [&] { return random.NextFloat(-500.0f, 500.0f); });
+        const std::vector<float> centerZ = random.Generate(CullingBoundsCount, [&] { return random.NextFloat(-500.0f, 500.0f); });
+        const std::vector<float> radius  = random.Generate(CullingBoundsCount, [&] { return random.NextFloat(0.5f, 5.0f); });
+        std::vector<uint8>       mask((CullingBoundsCount + 7) / 8);
+
+        JobSystem    jobSystem(workerCount);
+        const uint32 blockCount = (CullingBoundsCount + CullingBlockSize - 1) / CullingBlockSize;
+
+        state.Run(CullingBoundsCount, [&] {
+            jobSystem.ParallelFor(blockCount, 0, [&](uint32 beginBlock, uint32 endBlock) {
+                const uint32 begin = beginBlock * CullingBlockSize;
+                const uint32 end   = std::min(CullingBoundsCount, endBlock * CullingBlockSize);
+                frustum.CullSpheres(centerX.data() + begin, centerY.data() + begin, centerZ.data() + begin, radius.data() + begin, end - begin, mask.data() + begin / 8);
+            });
+            DoNotOptimize(mask.data());
+            ClobberMemory();
+        });
+
+        size_t visible = 0;
+        for (uint32 i = 0; i < CullingBoundsCount; i++)
+        {
+            visible += Frustum::IsVisible(mask.data(), i) ? 1 : 0;
+        }
+        state.SetCounter("Threads", double(jobSystem.GetThreadCount()));
+        state.SetCounter("visible", double(visible));
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// JobSystem 확장성
+// 같은 작업을 스레드 수만 바꾸어 측정 (ns/op 는 항목 하나당, 이상적이면 스레드 수에 반비례)
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Job, ParallelFor_Compute_1Thread)
+{
+    RunParallelCompute(state, 0);
+}
+
+TDME_BENCHMARK(Job, ParallelFor_Compute_2Threads)
+{
+    RunParallelCompute(state, 1);
+}
+
+TDME_BENCHMARK(Job, ParallelFor_Compute_4Threads)
+{
+    RunParallelCompute(state, 3);
+}
+
+TDME_BENCHMARK(Job, ParallelFor_Compute_8Threads)
+{
+    RunParallelCompute(state, 7);
+}
+
+TDME_BENCHMARK(Job, ParallelFor_Compute_16Threads)
+{
+    RunParallelCompute(state, 15);
+}
+
+TDME_BENCHMARK(Job, ParallelFor_Uneven_1Thread)
+{
+    RunParallelUneven(state, 0);
+}
+
+TDME_BENCHMARK(Job, ParallelFor_Uneven_4Threads)
+{
+    RunParallelUneven(state, 3);
+}
+
+TDME_BENCHMARK(Job, ParallelFor_Uneven_16Threads)
+{
+    RunParallelUneven(state, 15);
+}
+
+TDME_BENCHMARK(Job, CullSpheres_1Thread)
+{
+    RunParallelCulling(state, 0);
+}
+
+TDME_BENCHMARK(Job, CullSpheres_4Threads)
+{
+    RunParallelCulling(state, 3);
+}
+
+TDME_BENCHMARK(Job, CullSpheres_16Threads)
+{
+    RunParallelCulling(state, 15);
+}
+
+//////////////////////////////////////////////////////////////
+// JobSystem 오버헤드
+//////////////////////////////////////////////////////////////
+
+// 빈 작업 1024 개를 넣고 메인 스레드도 참여하여 Wait (ns/op 는 작업 하나당 추가 / 실행 / 완료 비용)
+TDME_BENCHMARK(Job, RunWait_Empty)
+{
+    JobSystem jobSystem(OverheadWorkerCount);
+
+    std::atomic<uint32> executedCount{ 0 };
+    state.Run(EmptyJobCount, [&] {
+        JobCounter counter;
+        for (uint32 i = 0; i < EmptyJobCount; i++)
+        {
+            jobSystem.Run([](void* context, uint32, uint32) { static_cast<std::atomic<uint32>*>(context)->fetch_add(1, std::memory_order_relaxed); }, &executedCount, counter);
+        }
+        jobSystem.Wait(counter);
+    });
+
+    state.SetCounter("Threads", double(jobSystem.GetThreadCount()));
+    DoNotOptimize(executedCount);
+}
\ No newline at end of file
@@ -0,0 +1,289 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkRunner.h"
+
+#include "Core/Math/SIMD/SIMDCommon.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+
+namespace TDME
+{
+    namespace Benchmark
+    {
+        namespace Detail
+        {
+            void UseCharPointer(const volatile char* /*pointer*/) {}
+        } // namespace Detail
+
+        //////////////////////////////////////////////////////////////
+        // BenchmarkRegistry
+        //////////////////////////////////////////////////////////////
+
+        BenchmarkRegistry& BenchmarkRegistry::Get()
+        {
+            static BenchmarkRegistry registry;
+            return registry;
+        }
+
+        void BenchmarkRegistry::Register(const char* category, const char* name, BenchmarkFunction function)
+        {
+            m_benchmarks.push_back({ category, name, function });
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 내부 헬퍼
+        //////////////////////////////////////////////////////////////
+
+        namespace
+        {
+            /**
+             * @brief 빌드에 사용된 SIMD 명령어 세트 이름
+             */
+            const char* GetSIMDName()
+            {
+#if TDME_SIMD_AVX2
+                return "AVX2";
+#elif TDME_SIMD_AVX
+                return "AVX";
+#elif TDME_SIMD_SSE
+                return "SSE2";
+#else
+                return "Scalar";
+#endif
+            }
+
+            /**
+             * @brief 컴파일러 이름과 버전
+             */
+            std::string GetCompilerName()
+            {
+#if TDME_COMPILER_MSVC
+                return "MSVC " + std::to_string(_MSC_VER);
+#elif TDME_COMPILER_CLANG
+                return "Clang " + std::to_string(__clang_major__) + "." + std::to_string(__clang_minor__);
+#elif TDME_COMPILER_GCC
+                return "GCC " + std::to_string(__GNUC__) + "." + std::to_string(__GNUC_MINOR__);
+#else
+                return "Unknown";
+#endif
+            }
+
+            /**
+             * @brief JSON 문자열 이스케이프
+             */
+            std::string EscapeJson(const std::string& text)
+            {
+                std::string result;
+                result.reserve(text.size());
+                for (char c : text)
+                {
+                    switch (c)
+                    {
+                    case '"':  result += "\\\""; break;
+                    case '\\': result += "\\\\"; break;
+                    case '\n': result += "\\n"; break;
+                    case '\t': result += "\\t"; break;
+                    default:   result += c; break;
+                    }
+                }
+                return result;
+            }
+
+            /**
+             * @brief JSON 숫자 출력 (NaN / Inf 는 JSON 에서 표현할 수 없으므로 null)
+             */
+            std::string FormatJsonNumber(double value)
+            {
+                if (!std::isfinite(value))
+                    return "null";
+
+                char buffer[64];
+                std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+                return buffer;
+            }
+
+            /**
+             * @brief 샘플 목록으로 결과 통계 계산
+             */
+            BenchmarkResult MakeResult(const BenchmarkInfo& info, const BenchmarkState& state)
+            {
+                BenchmarkResult result;
+                result.Category     = info.Category;
+                result.Name         = info.Name;
+                result.Iterations   = state.GetIterations();
+                result.ItemsPerCall = state.GetItemsPerCall();
+                result.Counters     = state.GetCounters();
+                result.ErrorMessage = state.GetErrorMessage();
+
+                std::vector<double> samples = state.GetSamples();
+                if (samples.empty())
+                    return result;
+
+                std::sort(samples.begin(), samples.end());
+                const size_t count = samples.size();
+
+                double sum = 0.0;
+                for (double sample : samples)
+                {
+                    sum += sample;
+                }
+                const double mean = sum / double(count);
+
+                double variance = 0.0;
+                for (double sample : samples)
+                {
+                    variance += (sample - mean) * (sample - mean);
+                }
+
+                result.NsPerOp       = (count % 2 == 1) ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) * 0.5;
+                result.NsPerOpMin    = samples.front();
+                result.NsPerOpMean   = mean;
+                result.NsPerOpStdDev = (count > 1) ? std::sqrt(variance / double(count - 1)) : 0.0;
+                result.OpsPerSecond  = (result.NsPerOp > 0.0) ? 1e9 / result.NsPerOp : 0.0;
+                return result;
+            }
+        } // namespace
+
+        //////////////////////////////////////////////////////////////
+        // BenchmarkRunner
+        //////////////////////////////////////////////////////////////
+
+        BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions& options)
+            : m_options(options)
+        {
+        }
+
+        std::vector<BenchmarkInfo> BenchmarkRunner::GetFilteredBenchmarks() const
+        {
+            std::vector<BenchmarkInfo> benchmarks;
+            for (const BenchmarkInfo& info : BenchmarkRegistry::Get().GetBenchmarks())
+            {
+                if (m_options.Filter.empty() || info.GetFullName().find(m_options.Filter) != std::string::npos)
+                {
+                    benchmarks.push_back(info);
+                }
+            }
+
+            // 정적 초기화 순서는 번역 단위 간에 정해져 있지 않으므로 이름으로 정렬
+            std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkInfo& a, const BenchmarkInfo& b) {
+                return a.Category != b.Category ? a.Category < b.Category : a.Name < b.Name;
+            });
+            return benchmarks;
+        }
+
+        std::vector<BenchmarkResult> BenchmarkRunner::RunAll() const
+        {
+            std::vector<BenchmarkResult> results;
+            for (const BenchmarkInfo& info : GetFilteredBenchmarks())
+            {
+                std::printf("Running %s...\n", info.GetFullName().c_str());
+                std::fflush(stdout);
+
+                BenchmarkState state(m_options.MinTimeSeconds, m_options.Repetitions);
+                info.Function(state);
+                results.push_back(MakeResult(info, state));
+            }
+            return results;
+        }
+
+        void BenchmarkRunner::PrintList() const
+        {
+            for (const BenchmarkInfo& info : GetFilteredBenchmarks())
+            {
+                std::printf("%s\n", info.GetFullName().c_str());
+            }
+        }
+
+        void BenchmarkRunner::PrintTable(const std::vector<BenchmarkResult>& results)
+        {
+            std::printf("\n[%s, %s, %s]\n", GetCompilerName().c_str(), GetSIMDName(), sizeof(void*) == 8 ? "x64" : "x86");
+            std::printf("%-44s %12s %12s %8s %14s  %s\n", "Benchmark", "ns/op", "min ns/op", "stddev", "Mops/s", "Counters");
+            std::printf("%s\n", std::string(110, '-').c_str());
+
+            for (const BenchmarkResult& result : results)
+            {
+                const std::string fullName = result.Category + "/" + result.Name;
+                if (!result.ErrorMessage.empty())
+                {
+                    std::printf("%-44s ERROR: %s\n", fullName.c_str(), result.ErrorMessage.c_str());
+                    continue;
+                }
+
+                const double      relative = (result.NsPerOp > 0.0) ? result.NsPerOpStdDev / result.NsPerOp * 100.0 : 0.0;
+
+                std::printf("%-44s %12.3f %12.3f %7.1f%% %14.2f ", fullName.c_str(), result.NsPerOp, result.NsPerOpMin, relative, result.OpsPerSecond / 1e6);
+                for (const std::pair<std::string, double>& counter : result.Counters)
+                {
+                    std::printf(" %s=%g", counter.first.c_str(), counter.second);
+                }
+                std::printf("\n");
+            }
+        }
+
+        bool BenchmarkRunner::WriteJson(const std::string& path, const std::vector<BenchmarkResult>& results)
+        {
+            std::ofstream file(path, std::ios::out | std::ios::trunc);
+            if (!file.is_open())
+                return false;
+
+            char              timestamp[32] = {};
+            const std::time_t now           = std::time(nullptr);
+            std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+            file << "{\n";
+            file << "  \"context\": {\n";
+            file << "    \"date\": \"" << timestamp << "\",\n";
+            file << "    \"compiler\": \"" << EscapeJson(GetCompilerName()) << "\",\n";
+            file << "    \"simd\": \"" << GetSIMDName() << "\",\n";
+            file << "    \"pointer_bits\": " << sizeof(void*) * 8 << ",\n";
+#ifdef NDEBUG
+            file << "    \"build\": \"Release\"\n";
+#else
+            file << "    \"build\": \"Debug\"\n";
+#endif
+            file << "  },\n";
+            file << "  \"benchmarks\": [";
+
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                const BenchmarkResult& result = results[i];
+
+                file << (i == 0 ? "\n" : ",\n");
+                file << "    {\n";
+                file << "      \"name\": \"" << EscapeJson(result.Category + "/" + result.Name) << "\",\n";
+                file << "      \"category\": \"" << EscapeJson(result.Category) << "\",\n";
+                file << "      \"iterations\": " << result.Iterations << ",\n";
+                file << "      \"items_per_call\": " << result.ItemsPerCall << ",\n";
+                if (!result.ErrorMessage.empty())
+                {
+                    file << "      \"error_occurred\": true,\n";
+                    file << "      \"error_message\": \"" << EscapeJson(result.ErrorMessage) << "\",\n";
+                }
+                file << "      \"ns_per_op\": " << FormatJsonNumber(result.NsPerOp) << ",\n";
+                file << "      \"ns_per_op_min\": " << FormatJsonNumber(result.NsPerOpMin) << ",\n";
+                file << "      \"ns_per_op_mean\": " << FormatJsonNumber(result.NsPerOpMean) << ",\n";
+                file << "      \"ns_per_op_stddev\": " << FormatJsonNumber(result.NsPerOpStdDev) << ",\n";
+                file << "      \"ops_per_second\": " << FormatJsonNumber(result.OpsPerSecond) << ",\n";
+                file << "      \"counters\": {";
+                for (size_t c = 0; c < result.Counters.size(); c++)
+                {
+                    file << (c == 0 ? " " : ", ") << "\"" << EscapeJson(result.Counters[c].first) << "\": " << FormatJsonNumber(result.Counters[c].second);
+                }
+                file << (result.Counters.empty() ? "}\n" : " }\n");
+                file << "    }";
+            }
+
+            file << (results.empty() ? "]\n" : "\n  ]\n");
+            file << "}\n";
+            return file.good();
+        }
+
+        size_t BenchmarkRunner::CountErrors(const std::vector<BenchmarkResult>& results)
+        {
+            return static_cast<size_t>(std::count_if(results.begin(), results.end(), [](const BenchmarkResult& result) { return !result.ErrorMessage.empty(); }));
+        }
+    } // namespace Benchmark
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Core/Geometry/TFrustum.h"
+#include "Core/Math/Projections.h"
+#include "Core/Math/Transformations.h"
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    /**
+     * @brief 컬링 벤치마크의 경계 볼륨 개수 (대규모 씬 가정)
+     */
+    constexpr size_t CullingBoundsCount = 100000;
+
+    /**
+     * @brief 원점 근처를 바라보는 카메라의 절두체
+     */
+    Frustum MakeCameraFrustum()
+    {
+        const Matrix view       = LookAtLH(Vector3(0.0f, 50.0f, -300.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+        const Matrix projection = PerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+        return Frustum(view * projection);
+    }
+
+    /**
+     * @brief SoA 경계 볼륨 배열 (중심 + 구 반지름 / 상자 반크기)
+     * @details 중심은 카메라 주변 ±500 범위에 분포하여 일부만 보이도록 함
+     */
+    struct BoundsArrays
+    {
+        std::vector<float> CenterX, CenterY, CenterZ;
+        std::vector<float> Radius;
+        std::vector<float> ExtentX, ExtentY, ExtentZ;
+
+        BoundsArrays(BenchmarkRandom& random, size_t count)
+        {
+            CenterX = random.Generate(count, [&] { return random.NextFloat(-500.0f, 500.0f); });
+            CenterY = random.Generate(count, [&] { return random.NextFloat(-500.0f, 500.0f); });
+            CenterZ = random.Generate(count, [&] { return random.NextFloat(-500.0f, 500.0f); });
+            Radius  = random.Generate(count, [&] { return random.NextFloat(0.5f, 5.0f); });
+            ExtentX = random.Generate(count, [&] { return random.NextFloat(0.5f, 5.0f); });
+            ExtentY = random.Generate(count, [&] { return random.NextFloat(0.5f, 5.0f); });
+            ExtentZ = random.Generate(count, [&] { return random.NextFloat(0.5f, 5.0f); });
+        }
+    };
+
+    /**
+     * @brief 마스크에서 보이는 항목 개수
+     */
+    size_t CountVisible(const std::vector<uint8>& mask, size_t count)
+    {
+        size_t visible = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            visible += Frustum::IsVisible(mask.data(), i) ? 1 : 0;
+        }
+        return visible;
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// TFrustum 컬링
+// visible 카운터는 보이는 경계 볼륨 개수 (스칼라 / 배치 결과가 같아야 함)
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Frustum, IntersectsSphereLoop)
+{
+    BenchmarkRandom    random;
+    const Frustum      frustum = MakeCameraFrustum();
+    const BoundsArrays bounds(random, CullingBoundsCount);
+    std::vector<uint8> output(CullingBoundsCount);
+
+    state.Run(CullingBoundsCount, [&] {
+        for (size_t i = 0; i < CullingBoundsCount; i++)
+        {
+            const BoundingSphere sphere(Vector3(bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i]), bounds.Radius[i]);
+            output[i] = frustum.Intersects(sphere) ? 1 : 0;
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+
+    size_t visible = 0;
+    for (uint8 value : output)
+    {
+        visible += value;
+    }
+    state.SetCounter("visible", double(visible));
+}
+
+TDME_BENCHMARK(Frustum, CullSpheres)
+{
+    BenchmarkRandom    random;
+    const Frustum      frustum = MakeCameraFrustum();
+    const BoundsArrays bounds(random, CullingBoundsCount);
+    std::vector<uint8> mask((CullingBoundsCount + 7) / 8);
+
+    state.Run(CullingBoundsCount, [&] {
+        frustum.CullSpheres(bounds.CenterX.data(), bounds.CenterY.data(), bounds.CenterZ.data(), bounds.Radius.data(), CullingBoundsCount, mask.data());
+        DoNotOptimize(mask.data());
+        ClobberMemory();
+    });
+
+    state.SetCounter("visible", double(CountVisible(mask, CullingBoundsCount)));
+}
+
+TDME_BENCHMARK(Frustum, IntersectsBoxLoop)
+{
+    BenchmarkRandom    random;
+    const Frustum      frustum = MakeCameraFrustum();
+    const BoundsArrays bounds(random, CullingBoundsCount);
+    std::vector<uint8> output(CullingBoundsCount);
+
+    state.Run(CullingBoundsCount, [&] {
+        for (size_t i = 0; i < CullingBoundsCount; i++)
+        {
+            const AABB box = AABB::FromCenterExtents(Vector3(bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i]),
+                                                     Vector3(bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i]));
+            output[i] = frustum.Intersects(box) ? 1 : 0;
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+
+    size_t visible = 0;
+    for (uint8 value : output)
+    {
+        visible += value;
+    }
+    state.SetCounter("visible", double(visible));
+}
+
+TDME_BENCHMARK(Frustum, CullBoxes)
+{
+    BenchmarkRandom    random;
+    const Frustum      frustum = MakeCameraFrustum();
+    const BoundsArrays bounds(random, CullingBoundsCount);
+    std::vector<uint8> mask((CullingBoundsCount + 7) / 8);
+
+    state.Run(CullingBoundsCount, [&] {
+        frustum.CullBoxes(bounds.CenterX.data(), bounds.CenterY.data(), bounds.CenterZ.data(),
+                          bounds.ExtentX.data(), bounds.ExtentY.data(), bounds.ExtentZ.data(), CullingBoundsCount, mask.data());
+        DoNotOptimize(mask.data());
+        ClobberMemory();
+    });
+
+    state.SetCounter("visible", double(CountVisible(mask, CullingBoundsCount)));
+}
\ No newline at end of file
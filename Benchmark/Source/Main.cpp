@@ -0,0 +1,105 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkRunner.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    void PrintUsage(const char* program)
+    {
+        std::printf("Usage: %s [options]\n", program);
+        std::printf("  --filter=<text>      \"Category/Name\" 에 text 가 포함된 벤치마크만 실행\n");
+        std::printf("  --json=<path>        결과를 JSON 파일로 저장\n");
+        std::printf("  --min-time=<sec>     벤치마크 하나당 측정 시간 (기본 0.5)\n");
+        std::printf("  --repetitions=<n>    샘플 개수 (기본 5, 중앙값 보고)\n");
+        std::printf("  --list               벤치마크 목록만 출력\n");
+    }
+
+    /**
+     * @brief "--name=value" 형식 인자에서 value 추출
+     * @return const char* 이름이 일치하지 않으면 nullptr
+     */
+    const char* GetOptionValue(const char* argument, const char* name)
+    {
+        const size_t length = std::strlen(name);
+        if (std::strncmp(argument, name, length) == 0 && argument[length] == '=')
+            return argument + length + 1;
+        return nullptr;
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* argument = argv[i];
+        const char* value    = nullptr;
+
+        if ((value = GetOptionValue(argument, "--filter")) != nullptr)
+        {
+            options.Filter = value;
+        }
+        else if ((value = GetOptionValue(argument, "--json")) != nullptr)
+        {
+            options.JsonPath = value;
+        }
+        else if ((value = GetOptionValue(argument, "--min-time")) != nullptr)
+        {
+            options.MinTimeSeconds = std::atof(value);
+        }
+        else if ((value = GetOptionValue(argument, "--repetitions")) != nullptr)
+        {
+            options.Repetitions = size_t(std::atoi(value));
+        }
+        else if (std::strcmp(argument, "--list") == 0)
+        {
+            options.ListOnly = true;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return std::strcmp(argument, "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    if (options.MinTimeSeconds <= 0.0 || options.Repetitions == 0)
+    {
+        std::fprintf(stderr, "--min-time 과 --repetitions 는 0 보다 커야 합니다.\n");
+        return 1;
+    }
+
+    BenchmarkRunner runner(options);
+    if (options.ListOnly)
+    {
+        runner.PrintList();
+        return 0;
+    }
+
+    const std::vector<BenchmarkResult> results = runner.RunAll();
+    BenchmarkRunner::PrintTable(results);
+
+    if (!options.JsonPath.empty())
+    {
+        if (!BenchmarkRunner::WriteJson(options.JsonPath, results))
+        {
+            std::fprintf(stderr, "JSON 파일을 저장하지 못했습니다: %s\n", options.JsonPath.c_str());
+            return 1;
+        }
+        std::printf("\nJSON 결과 저장: %s\n", options.JsonPath.c_str());
+    }
+
+    const size_t errorCount = BenchmarkRunner::CountErrors(results);
+    if (errorCount > 0)
+    {
+        std::fprintf(stderr, "\n실패한 벤치마크가 %zu 개 있습니다.\n", errorCount);
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
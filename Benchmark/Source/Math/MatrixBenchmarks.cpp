@@ -0,0 +1,194 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Core/Math/Projections.h"
+#include "Core/Math/TMatrix3x4.h"
+#include "Core/Math/TMatrix4x4.h"
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    /**
+     * @brief 임의의 TRS 아핀 행렬 배열 생성
+     */
+    std::vector<Matrix> GenerateAffineMatrices(BenchmarkRandom& random, size_t count)
+    {
+        return random.Generate(count, [&] { return random.NextTransform().ToMatrix(); });
+    }
+
+    /**
+     * @brief 임의의 비아핀 행렬 배열 생성 (일반 역행렬 경로 측정용)
+     * @details 투영 행렬을 곱해 4열이 (0, 0, 0, 1) 이 아니도록 만듦
+     */
+    std::vector<Matrix> GenerateProjectiveMatrices(BenchmarkRandom& random, size_t count)
+    {
+        const Matrix projection = PerspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+        return random.Generate(count, [&] { return random.NextTransform().ToMatrix() * projection; });
+    }
+
+    /**
+     * @brief 임의의 TRS 3x4 아핀 행렬 배열 생성
+     */
+    std::vector<Matrix3x4> GenerateAffineMatrices3x4(BenchmarkRandom& random, size_t count)
+    {
+        return random.Generate(count, [&] { return random.NextTransform().ToMatrix3x4(); });
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// TMatrix4x4
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Matrix, Multiply)
+{
+    BenchmarkRandom           random;
+    const std::vector<Matrix> a = GenerateAffineMatrices(random, DefaultBatchSize);
+    const std::vector<Matrix> b = GenerateAffineMatrices(random, DefaultBatchSize);
+    std::vector<Matrix>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i] * b[i];
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Matrix, Inverse)
+{
+    BenchmarkRandom           random;
+    const std::vector<Matrix> input = GenerateProjectiveMatrices(random, DefaultBatchSize);
+    std::vector<Matrix>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].Inverse();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Matrix, InverseAffine)
+{
+    BenchmarkRandom           random;
+    const std::vector<Matrix> input = GenerateAffineMatrices(random, DefaultBatchSize);
+    std::vector<Matrix>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].InverseAffine();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Matrix, InverseRigid)
+{
+    BenchmarkRandom           random;
+    const std::vector<Matrix> input = random.Generate(DefaultBatchSize, [&] {
+        return Transform(random.NextVector3(-100.0f, 100.0f), random.NextUnitQuaternion(), Vector3::One()).ToMatrix();
+    });
+    std::vector<Matrix> output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].InverseRigid();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Matrix, Transposed)
+{
+    BenchmarkRandom           random;
+    const std::vector<Matrix> input = GenerateAffineMatrices(random, DefaultBatchSize);
+    std::vector<Matrix>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].Transposed();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Matrix, Determinant)
+{
+    BenchmarkRandom           random;
+    const std::vector<Matrix> input = GenerateProjectiveMatrices(random, DefaultBatchSize);
+    std::vector<float>        output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].Determinant();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+//////////////////////////////////////////////////////////////
+// TMatrix3x4 (같은 TRS 입력에 대한 Matrix 벤치마크와 비교)
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Matrix3x4, Multiply)
+{
+    BenchmarkRandom              random;
+    const std::vector<Matrix3x4> a = GenerateAffineMatrices3x4(random, DefaultBatchSize);
+    const std::vector<Matrix3x4> b = GenerateAffineMatrices3x4(random, DefaultBatchSize);
+    std::vector<Matrix3x4>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i] * b[i];
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Matrix3x4, Inverse)
+{
+    BenchmarkRandom              random;
+    const std::vector<Matrix3x4> input = GenerateAffineMatrices3x4(random, DefaultBatchSize);
+    std::vector<Matrix3x4>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].Inverse();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Matrix3x4, FromTransform)
+{
+    BenchmarkRandom              random;
+    const std::vector<Transform> input = random.Generate(DefaultBatchSize, [&] { return random.NextTransform(); });
+    std::vector<Matrix3x4>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].ToMatrix3x4();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
\ No newline at end of file
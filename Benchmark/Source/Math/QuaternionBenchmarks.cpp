@@ -0,0 +1,269 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Core/Math/QuaternionBatch.h"
+#include "Core/Math/TQuaternion.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    /**
+     * @brief SoA 쿼터니언 배열 (성분별 std::vector 보관)
+     */
+    struct QuaternionArrays
+    {
+        std::vector<float> X, Y, Z, W;
+
+        explicit QuaternionArrays(size_t count) : X(count), Y(count), Z(count), W(count) {}
+
+        QuaternionSoA GetView() { return QuaternionSoA(X.data(), Y.data(), Z.data(), W.data()); }
+
+        /**
+         * @brief 네 성분 배열에 쓴 결과가 최적화로 제거되지 않도록 함
+         */
+        void DoNotOptimizeData() const
+        {
+            DoNotOptimize(X.data());
+            DoNotOptimize(Y.data());
+            DoNotOptimize(Z.data());
+            DoNotOptimize(W.data());
+        }
+    };
+
+    /**
+     * @brief 임의의 단위 쿼터니언으로 채운 SoA 배열 생성
+     */
+    QuaternionArrays GenerateQuaternionArrays(BenchmarkRandom& random, size_t count)
+    {
+        const std::vector<Quaternion> quaternions = random.Generate(count, [&] { return random.NextUnitQuaternion(); });
+
+        QuaternionArrays arrays(count);
+        QuaternionBatch::Scatter(quaternions.data(), count, arrays.GetView());
+        return arrays;
+    }
+
+    /**
+     * @brief 두 쿼터니언의 성분별 최대 절대 오차
+     */
+    float GetMaxAbsError(const Quaternion& a, const Quaternion& b)
+    {
+        return std::max({ std::abs(a.X - b.X), std::abs(a.Y - b.Y), std::abs(a.Z - b.Z), std::abs(a.W - b.W) });
+    }
+
+    /**
+     * @brief 두 행렬의 요소별 최대 절대 오차
+     */
+    float GetMaxAbsError(const Matrix& a, const Matrix& b)
+    {
+        float error = 0.0f;
+        for (size_t i = 0; i < 16; i++)
+        {
+            error = std::max(error, std::abs(a.Data[i] - b.Data[i]));
+        }
+        return error;
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// TQuaternion (스칼라)
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Quaternion, Multiply)
+{
+    BenchmarkRandom               random;
+    const std::vector<Quaternion> a = random.Generate(DefaultBatchSize, [&] { return random.NextUnitQuaternion(); });
+    const std::vector<Quaternion> b = random.Generate(DefaultBatchSize, [&] { return random.NextUnitQuaternion(); });
+    std::vector<Quaternion>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i] * b[i];
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Quaternion, Normalize)
+{
+    BenchmarkRandom               random;
+    const std::vector<Quaternion> input = random.Generate(DefaultBatchSize, [&] { return random.NextUnitQuaternion() * random.NextFloat(0.5f, 2.0f); });
+    std::vector<Quaternion>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i];
+            output[i].Normalize();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Quaternion, Slerp)
+{
+    BenchmarkRandom               random;
+    const std::vector<Quaternion> a = random.Generate(DefaultBatchSize, [&] { return random.NextUnitQuaternion(); });
+    const std::vector<Quaternion> b = random.Generate(DefaultBatchSize, [&] { return random.NextUnitQuaternion(); });
+    const std::vector<float>      t = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(0.0f, 1.0f); });
+    std::vector<Quaternion>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = Quaternion::Slerp(a[i], b[i], t[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Quaternion, ToMatrix)
+{
+    BenchmarkRandom               random;
+    const std::vector<Quaternion> input = random.Generate(DefaultBatchSize, [&] { return random.NextUnitQuaternion(); });
+    std::vector<Matrix>           output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = Quaternion::ToMatrix(input[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Quaternion, RotateVector)
+{
+    BenchmarkRandom               random;
+    const std::vector<Quaternion> rotations = random.Generate(DefaultBatchSize, [&] { return random.NextUnitQuaternion(); });
+    const std::vector<Vector3>    vectors   = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>          output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = rotations[i].RotateVector(vectors[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+//////////////////////////////////////////////////////////////
+// QuaternionBatch (SoA)
+// 측정 전에 스칼라 TQuaternion 결과와 비교한 최대 절대 오차를 max_abs_error 카운터로 보고하고,
+// QuaternionBatch.h 에 적힌 허용 오차를 넘으면 실패로 기록
+//////////////////////////////////////////////////////////////
+
+namespace
+{
+    constexpr float ApproximateTolerance = 1e-6f; // Normalize / Slerp (근사 계산, 단위 쿼터니언 기준)
+    constexpr float ContractionTolerance = 1e-7f; // Multiply / ToMatrix (연산 순서는 같고 FMA 축약에 의한 마지막 비트 차이만 허용)
+} // namespace
+
+TDME_BENCHMARK(QuaternionBatch, Normalize)
+{
+    BenchmarkRandom  random;
+    QuaternionArrays input(DefaultBatchSize);
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        input.GetView().Set(i, random.NextUnitQuaternion() * random.NextFloat(0.5f, 2.0f));
+    }
+    QuaternionArrays output(DefaultBatchSize);
+
+    QuaternionBatch::Normalize(input.GetView(), output.GetView(), DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        Quaternion expected = input.GetView().Get(i);
+        expected.Normalize();
+        maxError = std::max(maxError, GetMaxAbsError(expected, output.GetView().Get(i)));
+    }
+    state.CheckError("max_abs_error", maxError, ApproximateTolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        QuaternionBatch::Normalize(input.GetView(), output.GetView(), DefaultBatchSize);
+        output.DoNotOptimizeData();
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(QuaternionBatch, Multiply)
+{
+    BenchmarkRandom  random;
+    QuaternionArrays a = GenerateQuaternionArrays(random, DefaultBatchSize);
+    QuaternionArrays b = GenerateQuaternionArrays(random, DefaultBatchSize);
+    QuaternionArrays output(DefaultBatchSize);
+
+    QuaternionBatch::Multiply(a.GetView(), b.GetView(), output.GetView(), DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        maxError = std::max(maxError, GetMaxAbsError(a.GetView().Get(i) * b.GetView().Get(i), output.GetView().Get(i)));
+    }
+    state.CheckError("max_abs_error", maxError, ContractionTolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        QuaternionBatch::Multiply(a.GetView(), b.GetView(), output.GetView(), DefaultBatchSize);
+        output.DoNotOptimizeData();
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(QuaternionBatch, Slerp)
+{
+    BenchmarkRandom          random;
+    QuaternionArrays         a = GenerateQuaternionArrays(random, DefaultBatchSize);
+    QuaternionArrays         b = GenerateQuaternionArrays(random, DefaultBatchSize);
+    const std::vector<float> t = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(0.0f, 1.0f); });
+    QuaternionArrays         output(DefaultBatchSize);
+
+    QuaternionBatch::Slerp(a.GetView(), b.GetView(), t.data(), output.GetView(), DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        const Quaternion expected = Quaternion::Slerp(a.GetView().Get(i), b.GetView().Get(i), t[i]);
+        maxError = std::max(maxError, GetMaxAbsError(expected, output.GetView().Get(i)));
+    }
+    state.CheckError("max_abs_error", maxError, ApproximateTolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        QuaternionBatch::Slerp(a.GetView(), b.GetView(), t.data(), output.GetView(), DefaultBatchSize);
+        output.DoNotOptimizeData();
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(QuaternionBatch, ToMatrix)
+{
+    BenchmarkRandom     random;
+    QuaternionArrays    input = GenerateQuaternionArrays(random, DefaultBatchSize);
+    std::vector<Matrix> output(DefaultBatchSize);
+
+    QuaternionBatch::ToMatrix(input.GetView(), output.data(), DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        maxError = std::max(maxError, GetMaxAbsError(Quaternion::ToMatrix(input.GetView().Get(i)), output[i]));
+    }
+    state.CheckError("max_abs_error", maxError, ContractionTolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        QuaternionBatch::ToMatrix(input.GetView(), output.data(), DefaultBatchSize);
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Core/Math/Projections.h"
+#include "Core/Math/Transform.h"
+#include "Core/Math/Transformations.h"
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+//////////////////////////////////////////////////////////////
+// Transform
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Transform, ToMatrix)
+{
+    BenchmarkRandom              random;
+    const std::vector<Transform> input = random.Generate(DefaultBatchSize, [&] { return random.NextTransform(); });
+    std::vector<Matrix>          output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].ToMatrix();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transform, Compose)
+{
+    BenchmarkRandom              random;
+    const std::vector<Transform> children = random.Generate(DefaultBatchSize, [&] { return random.NextTransform(); });
+    const std::vector<Transform> parents  = random.Generate(DefaultBatchSize, [&] { return random.NextTransform(); });
+    std::vector<Transform>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = children[i] * parents[i];
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transform, TransformPosition)
+{
+    BenchmarkRandom            random;
+    const Transform            transform = random.NextTransform();
+    const std::vector<Vector3> input     = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = transform.TransformPosition(input[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+//////////////////////////////////////////////////////////////
+// Transformations.h 헬퍼
+// TransformPositionLoop 는 단일 점 함수를 반복 호출하는 기준값, 나머지는 배열 API (float 은 SIMD 커널)
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Transformations, TransformPositionLoop)
+{
+    BenchmarkRandom            random;
+    const Matrix               matrix = random.NextTransform().ToMatrix();
+    const std::vector<Vector3> input  = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = TransformPosition(input[i], matrix);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transformations, TransformPositions)
+{
+    BenchmarkRandom            random;
+    const Matrix               matrix = random.NextTransform().ToMatrix();
+    const std::vector<Vector3> input  = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        TransformPositions(input.data(), output.data(), DefaultBatchSize, matrix);
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transformations, TransformPositionsPerMatrix)
+{
+    BenchmarkRandom            random;
+    const std::vector<Matrix>  matrices = random.Generate(DefaultBatchSize, [&] { return random.NextTransform().ToMatrix(); });
+    const std::vector<Vector3> input    = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        TransformPositions(input.data(), matrices.data(), output.data(), DefaultBatchSize);
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transformations, TransformPositionsSoA)
+{
+    BenchmarkRandom          random;
+    const Matrix             matrix = random.NextTransform().ToMatrix();
+    const std::vector<float> inX    = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    const std::vector<float> inY    = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    const std::vector<float> inZ    = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    std::vector<float>       outX(DefaultBatchSize), outY(DefaultBatchSize), outZ(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        TransformPositionsSoA(inX.data(), inY.data(), inZ.data(), outX.data(), outY.data(), outZ.data(), DefaultBatchSize, matrix);
+        DoNotOptimize(outX.data());
+        DoNotOptimize(outY.data());
+        DoNotOptimize(outZ.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transformations, TransformVectors)
+{
+    BenchmarkRandom            random;
+    const Matrix               matrix = random.NextTransform().ToMatrix();
+    const std::vector<Vector3> input  = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-1.0f, 1.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        TransformVectors(input.data(), output.data(), DefaultBatchSize, matrix);
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transformations, LookAtLH)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector3> eyes    = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-100.0f, 100.0f); });
+    const std::vector<Vector3> targets = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Matrix>        output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = LookAtLH(eyes[i], targets[i], Vector3(0.0f, 1.0f, 0.0f));
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Transformations, PerspectiveFovLH)
+{
+    BenchmarkRandom          random;
+    const std::vector<float> fovs = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(0.5f, 1.5f); });
+    std::vector<Matrix>      output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = PerspectiveFovLH(fovs[i], 16.0f / 9.0f, 0.1f, 1000.0f);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
\ No newline at end of file
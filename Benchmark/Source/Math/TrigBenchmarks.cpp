@@ -0,0 +1,152 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Core/Math/MathUtils.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+//////////////////////////////////////////////////////////////
+// 삼각함수 (std vs Math::Fast*)
+// Fast* 벤치마크는 측정 전에 std 결과와 비교한 최대 절대 오차를 max_abs_error 카운터로 보고하고,
+// MathUtils.h 에 적힌 허용 오차를 넘으면 실패로 기록
+//////////////////////////////////////////////////////////////
+
+namespace
+{
+    constexpr float SinCosTolerance = 1e-7f; // |angle| <= 8192 에서의 절대 오차
+    constexpr float Atan2Tolerance  = 3e-7f; // 라디안
+} // namespace
+
+TDME_BENCHMARK(Trig, StdSinCos)
+{
+    BenchmarkRandom          random;
+    const std::vector<float> angles = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-Math::Pi2, Math::Pi2); });
+    std::vector<float>       outSin(DefaultBatchSize), outCos(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            outSin[i] = std::sin(angles[i]);
+            outCos[i] = std::cos(angles[i]);
+        }
+        DoNotOptimize(outSin.data());
+        DoNotOptimize(outCos.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Trig, FastSinCos)
+{
+    BenchmarkRandom          random;
+    const std::vector<float> angles = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-Math::Pi2, Math::Pi2); });
+    std::vector<float>       outSin(DefaultBatchSize), outCos(DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        Math::FastSinCos(angles[i], outSin[i], outCos[i]);
+        maxError = std::max({ maxError, std::abs(outSin[i] - std::sin(angles[i])), std::abs(outCos[i] - std::cos(angles[i])) });
+    }
+    state.CheckError("max_abs_error", maxError, SinCosTolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            Math::FastSinCos(angles[i], outSin[i], outCos[i]);
+        }
+        DoNotOptimize(outSin.data());
+        DoNotOptimize(outCos.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Trig, FastSinCosArray)
+{
+    BenchmarkRandom          random;
+    const std::vector<float> angles = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-Math::Pi2, Math::Pi2); });
+    std::vector<float>       outSin(DefaultBatchSize), outCos(DefaultBatchSize);
+
+    Math::FastSinCos(angles.data(), outSin.data(), outCos.data(), DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        maxError = std::max({ maxError, std::abs(outSin[i] - std::sin(angles[i])), std::abs(outCos[i] - std::cos(angles[i])) });
+    }
+    state.CheckError("max_abs_error", maxError, SinCosTolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        Math::FastSinCos(angles.data(), outSin.data(), outCos.data(), DefaultBatchSize);
+        DoNotOptimize(outSin.data());
+        DoNotOptimize(outCos.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Trig, StdAtan2)
+{
+    BenchmarkRandom          random;
+    const std::vector<float> y = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    const std::vector<float> x = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    std::vector<float>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = std::atan2(y[i], x[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Trig, FastAtan2)
+{
+    BenchmarkRandom          random;
+    const std::vector<float> y = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    const std::vector<float> x = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    std::vector<float>       output(DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        maxError = std::max(maxError, std::abs(Math::FastAtan2(y[i], x[i]) - std::atan2(y[i], x[i])));
+    }
+    state.CheckError("max_abs_error", maxError, Atan2Tolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = Math::FastAtan2(y[i], x[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Trig, FastAtan2Array)
+{
+    BenchmarkRandom          random;
+    const std::vector<float> y = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    const std::vector<float> x = random.Generate(DefaultBatchSize, [&] { return random.NextFloat(-10.0f, 10.0f); });
+    std::vector<float>       output(DefaultBatchSize);
+
+    Math::FastAtan2(y.data(), x.data(), output.data(), DefaultBatchSize);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < DefaultBatchSize; i++)
+    {
+        maxError = std::max(maxError, std::abs(output[i] - std::atan2(y[i], x[i])));
+    }
+    state.CheckError("max_abs_error", maxError, Atan2Tolerance);
+
+    state.Run(DefaultBatchSize, [&] {
+        Math::FastAtan2(y.data(), x.data(), output.data(), DefaultBatchSize);
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
\ No newline at end of file
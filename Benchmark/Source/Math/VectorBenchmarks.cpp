@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Core/Math/TVector2.h"
+#include "Core/Math/TVector3.h"
+#include "Core/Math/TVector4.h"
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+//////////////////////////////////////////////////////////////
+// TVector2 / TVector3 / TVector4 (TVectorOperations 공통 연산)
+// 모든 벤치마크는 DefaultBatchSize 개의 요소를 처리하며 ns/op 는 요소 하나 기준
+//////////////////////////////////////////////////////////////
+
+TDME_BENCHMARK(Vector, Vector2Normalize)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector2> input = random.Generate(DefaultBatchSize, [&] { return random.NextVector2(-10.0f, 10.0f); });
+    std::vector<Vector2>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].Normalized();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Vector, Vector3Add)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector3> a = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    const std::vector<Vector3> b = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i] + b[i];
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Vector, Vector3Dot)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector3> a = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    const std::vector<Vector3> b = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<float>         output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i].Dot(b[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Vector, Vector3Cross)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector3> a = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    const std::vector<Vector3> b = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i].Cross(b[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Vector, Vector3Length)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector3> input = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<float>         output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].Length();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Vector, Vector3Normalize)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector3> input = random.Generate(DefaultBatchSize, [&] { return random.NextVector3(-10.0f, 10.0f); });
+    std::vector<Vector3>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = input[i].Normalized();
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Vector, Vector4Dot)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector4> a = random.Generate(DefaultBatchSize, [&] { return random.NextVector4(-10.0f, 10.0f); });
+    const std::vector<Vector4> b = random.Generate(DefaultBatchSize, [&] { return random.NextVector4(-10.0f, 10.0f); });
+    std::vector<float>         output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i].Dot(b[i]);
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
+
+TDME_BENCHMARK(Vector, Vector4MultiplyAdd)
+{
+    BenchmarkRandom            random;
+    const std::vector<Vector4> a = random.Generate(DefaultBatchSize, [&] { return random.NextVector4(-10.0f, 10.0f); });
+    const std::vector<Vector4> b = random.Generate(DefaultBatchSize, [&] { return random.NextVector4(-10.0f, 10.0f); });
+    std::vector<Vector4>       output(DefaultBatchSize);
+
+    state.Run(DefaultBatchSize, [&] {
+        for (size_t i = 0; i < DefaultBatchSize; i++)
+        {
+            output[i] = a[i] * b[i] + a[i] * 0.5f;
+        }
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    });
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Engine/Object/Actor/AActor.h"
+#include "Engine/Object/Component/GCameraComponent.h"
+
+#include <memory>
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    constexpr size_t ActorCount = DefaultBatchSize;
+
+    // 게임플레이 컴포넌트를 흉내 내는 빈 컴포넌트들
+    class GHealthComponent : public GActorComponent
+    {
+    public:
+        TDME_COMPONENT_TYPE(GHealthComponent, GActorComponent)
+    };
+
+    class GInventoryComponent : public GActorComponent
+    {
+    public:
+        TDME_COMPONENT_TYPE(GInventoryComponent, GActorComponent)
+    };
+
+    class GAIComponent : public GActorComponent
+    {
+    public:
+        TDME_COMPONENT_TYPE(GAIComponent, GActorComponent)
+    };
+
+    class GUnusedComponent : public GActorComponent
+    {
+    public:
+        TDME_COMPONENT_TYPE(GUnusedComponent, GActorComponent)
+    };
+
+    class GAudioComponent : public GSceneComponent
+    {
+    public:
+        TDME_COMPONENT_TYPE(GAudioComponent, GSceneComponent)
+    };
+
+    /**
+     * @brief 컴포넌트 8 개를 가진 Actor (찾는 컴포넌트는 마지막에 추가)
+     */
+    class AGameplayActor : public AActor
+    {
+    public:
+        AGameplayActor()
+        {
+            AddComponent<GSceneComponent>(true);
+            AddComponent<GHealthComponent>();
+            AddComponent<GInventoryComponent>();
+            AddComponent<GAudioComponent>();
+            AddComponent<GAIComponent>();
+            AddComponent<GSceneComponent>();
+            AddComponent<GAudioComponent>();
+            AddComponent<GCameraComponent>();
+        }
+    };
+
+    std::vector<std::unique_ptr<AGameplayActor>> CreateActors()
+    {
+        std::vector<std::unique_ptr<AGameplayActor>> actors;
+        for (size_t i = 0; i < ActorCount; i++)
+        {
+            actors.push_back(std::make_unique<AGameplayActor>());
+        }
+        return actors;
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// Actor
+//////////////////////////////////////////////////////////////
+
+// 마지막에 추가된 컴포넌트 조회
+TDME_BENCHMARK(Actor, GetComponent_Exact)
+{
+    const auto actors = CreateActors();
+
+    state.Run(ActorCount, [&] {
+        for (const auto& actor : actors)
+        {
+            DoNotOptimize(actor->GetComponent<GCameraComponent>());
+        }
+    });
+}
+
+// 상위 타입으로 조회 (파생 타입 매칭)
+TDME_BENCHMARK(Actor, GetComponent_Base)
+{
+    const auto actors = CreateActors();
+
+    state.Run(ActorCount, [&] {
+        for (const auto& actor : actors)
+        {
+            DoNotOptimize(actor->GetComponent<GAIComponent>());
+            DoNotOptimize(actor->GetComponent<GSceneComponent>());
+        }
+    });
+}
+
+// 없는 타입 조회
+TDME_BENCHMARK(Actor, GetComponent_Missing)
+{
+    const auto actors = CreateActors();
+
+    state.Run(ActorCount, [&] {
+        for (const auto& actor : actors)
+        {
+            DoNotOptimize(actor->GetComponent<GUnusedComponent>());
+        }
+    });
+}
+
+// 특정 타입(및 파생 타입) 컴포넌트 전체 순회
+TDME_BENCHMARK(Actor, GetComponents_SceneComponents)
+{
+    const auto actors = CreateActors();
+
+    state.Run(ActorCount, [&] {
+        for (const auto& actor : actors)
+        {
+            for (GSceneComponent* component : actor->GetComponents<GSceneComponent>())
+            {
+                DoNotOptimize(component);
+            }
+        }
+    });
+}
\ No newline at end of file
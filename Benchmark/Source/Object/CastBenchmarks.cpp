@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Engine/Object/Actor/AActor.h"
+#include "Engine/Object/Component/GCameraComponent.h"
+
+#include <memory>
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    constexpr size_t ObjectCount = DefaultBatchSize;
+
+    // 게임플레이 Actor 계층 (깊이 4) 을 흉내 낸 클래스들
+    class APawn : public AActor
+    {
+        TDME_OBJECT_CLASS(APawn, AActor)
+    };
+
+    class ACharacter : public APawn
+    {
+        TDME_OBJECT_CLASS(ACharacter, APawn)
+    };
+
+    class APlayerCharacter : public ACharacter
+    {
+        TDME_OBJECT_CLASS(APlayerCharacter, ACharacter)
+    };
+
+    class AProp : public AActor
+    {
+        TDME_OBJECT_CLASS(AProp, AActor)
+    };
+
+    /**
+     * @brief 여러 클래스의 객체를 섞은 배열 (Level 의 Actor / 컴포넌트 목록을 흉내 냄)
+     */
+    std::vector<std::unique_ptr<GameObject>> CreateObjects()
+    {
+        std::vector<std::unique_ptr<GameObject>> objects;
+        for (size_t i = 0; i < ObjectCount; i++)
+        {
+            switch (i % 4)
+            {
+            case 0:  objects.push_back(std::make_unique<APlayerCharacter>()); break;
+            case 1:  objects.push_back(std::make_unique<AProp>()); break;
+            case 2:  objects.push_back(std::make_unique<GCameraComponent>()); break;
+            default: objects.push_back(std::make_unique<ACharacter>()); break;
+            }
+        }
+        return objects;
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// Object
+//////////////////////////////////////////////////////////////
+
+// 상위 클래스로 변환 (절반 성공, 절반 실패)
+TDME_BENCHMARK(Object, Cast_Base)
+{
+    const auto objects = CreateObjects();
+
+    uint32 hitCount = 0;
+    state.Run(ObjectCount, [&] {
+        for (const auto& object : objects)
+        {
+            APawn* pawn = Cast<APawn>(object.get());
+            hitCount += pawn != nullptr;
+            DoNotOptimize(pawn);
+        }
+    });
+    state.SetCounter("HitCount", static_cast<double>(hitCount));
+}
+
+// 가장 깊은 파생 클래스로 변환 (대부분 실패)
+TDME_BENCHMARK(Object, Cast_Leaf)
+{
+    const auto objects = CreateObjects();
+
+    state.Run(ObjectCount, [&] {
+        for (const auto& object : objects)
+        {
+            DoNotOptimize(Cast<APlayerCharacter>(object.get()));
+        }
+    });
+}
+
+// 다른 계층(컴포넌트) 클래스 검사
+TDME_BENCHMARK(Object, IsA_Unrelated)
+{
+    const auto objects = CreateObjects();
+
+    state.Run(ObjectCount, [&] {
+        for (const auto& object : objects)
+        {
+            DoNotOptimize(object->IsA<GSceneComponent>());
+        }
+    });
+}
\ No newline at end of file
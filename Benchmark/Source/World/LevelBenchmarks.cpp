@@ -0,0 +1,351 @@
+#include "pch.h"
+
+#include <Core/Async/JobSystem.h>
+#include <Core/Math/TQuaternion.h>
+
+#include "Engine/Object/Actor/AActor.h"
+#include "Engine/Object/Component/GSceneComponent.h"
+#include "Engine/Object/IRenderable.h"
+#include "Engine/World/Level.h"
+#include "Engine/World/LevelCommandBuffer.h"
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    constexpr size_t LevelActorCount    = 100000; // Level 에 스폰하는 Actor 수
+    constexpr size_t RenderableInterval = 100;    // Actor 100 개 중 1 개만 렌더링 가능
+    constexpr size_t TickingInterval    = 100;    // Actor 100 개 중 1 개만 Update 를 재정의
+    constexpr size_t ChurnActorCount    = 1000;   // 프레임마다 스폰 / 삭제하는 Actor 수 (투사체 / 파티클 등)
+    constexpr size_t WaveActorCount     = 10000;  // 한 프레임에 한꺼번에 삭제되는 Actor 수
+    constexpr size_t ParallelActorCount = 200000; // 병렬 Tick 하는 독립 Actor 수
+    constexpr size_t BulkSpawnCount     = 50000;  // 레벨 로드 / 웨이브 스폰에서 한꺼번에 생성하는 Actor 수
+
+    /**
+     * @brief 렌더링하지 않는 Actor (로직 / 트리거 등)
+     */
+    class AIdleActor : public AActor
+    {
+    };
+
+    /**
+     * @brief Render 호출 횟수만 세는 렌더링 가능 Actor
+     */
+    class ACountingRenderActor : public AActor, public IRenderable
+    {
+    public:
+        void Render() override { RenderCount++; }
+
+        uint32 RenderCount = 0;
+    };
+
+    /**
+     * @brief 경과 시간만 누적하는 Tick Actor
+     */
+    class ATickingActor : public AActor
+    {
+    public:
+        void Update(float deltaTime) override { Elapsed += deltaTime; }
+
+        float Elapsed = 0.0f;
+    };
+
+    /**
+     * @brief 자신의 Root Component 만 회전시키는 병렬 Tick Actor (서로 독립)
+     */
+    class ASpinningActor : public AActor
+    {
+    public:
+        ASpinningActor()
+        {
+            AddComponent<GSceneComponent>(true);
+            SetTickInParallel(true);
+        }
+
+        void Update(float deltaTime) override
+        {
+            m_angle += deltaTime;
+            m_rootComponent->SetRotation(Quaternion::FromRotationZ(m_angle));
+        }
+
+    private:
+        float m_angle = 0.0f;
+    };
+
+    /**
+     * @brief 작업 스레드 workerCount 개(+ 메인 스레드)로 병렬 Tick Actor 200k 개의 Tick 측정
+     * @details 병렬화된 Tick 만 측정 (이후의 TransformHierarchy 갱신은 메인 스레드에서 수행되므로 제외)
+     */
+    void RunParallelUpdate(BenchmarkState& state, uint32 workerCount)
+    {
+        JobSystem jobSystem(workerCount);
+        Level     level(nullptr, &jobSystem);
+        for (size_t i = 0; i < ParallelActorCount; i++)
+        {
+            level.SpawnActor<ASpinningActor>();
+        }
+
+        TickManager& tickManager = level.GetTickManager();
+        state.Run(ParallelActorCount, [&] {
+            tickManager.Tick(1.0f / 60.0f);
+            ClobberMemory();
+        });
+
+        state.SetCounter("Threads", double(workerCount + 1));
+    }
+
+    /**
+     * @brief SceneComponent 두 개를 가진 Actor (투사체처럼 짧게 살다 사라짐)
+     */
+    class AProjectileActor : public AActor
+    {
+    public:
+        AProjectileActor()
+        {
+            GSceneComponent* root = AddComponent<GSceneComponent>(true);
+            AddComponent<GSceneComponent>()->AttachToComponent(root);
+        }
+    };
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// Level
+//////////////////////////////////////////////////////////////
+
+// Actor 100k 개 중 1% 만 렌더링 가능한 Level 의 Render (ns/op 는 Actor 한 개당)
+TDME_BENCHMARK(Level, Render_SparseRenderables)
+{
+    Level level;
+    for (size_t i = 0; i < LevelActorCount; i++)
+    {
+        if (i % RenderableInterval == 0)
+        {
+            level.SpawnActor<ACountingRenderActor>();
+        }
+        else
+        {
+            level.SpawnActor<AIdleActor>();
+        }
+    }
+
+    state.Run(LevelActorCount, [&] {
+        level.Render();
+        ClobberMemory();
+    });
+
+    state.SetCounter("Renderables", double(LevelActorCount / RenderableInterval));
+}
+
+// Actor 100k 개 중 1% 만 Update 를 재정의한 Level 의 Update (ns/op 는 Actor 한 개당)
+TDME_BENCHMARK(Level, Update_SparseTickers)
+{
+    Level level;
+    for (size_t i = 0; i < LevelActorCount; i++)
+    {
+        if (i % TickingInterval == 0)
+        {
+            level.SpawnActor<ATickingActor>();
+        }
+        else
+        {
+            level.SpawnActor<AIdleActor>();
+        }
+    }
+
+    state.Run(LevelActorCount, [&] {
+        level.Update(1.0f / 60.0f);
+        ClobberMemory();
+    });
+
+    state.SetCounter("Tickers", double(LevelActorCount / TickingInterval));
+}
+
+// Actor 100k 개가 모두 Update 를 재정의한 Level 의 Update (ns/op 는 Actor 한 개당)
+TDME_BENCHMARK(Level, Update_AllTickers)
+{
+    Level level;
+    for (size_t i = 0; i < LevelActorCount; i++)
+    {
+        level.SpawnActor<ATickingActor>();
+    }
+
+    state.Run(LevelActorCount, [&] {
+        level.Update(1.0f / 60.0f);
+        ClobberMemory();
+    });
+}
+
+// 독립적인 병렬 Tick Actor 200k 개의 Tick (ns/op 는 Actor 한 개당, 스레드 수별 확장성 비교)
+TDME_BENCHMARK(Level, Update_Parallel_1Thread)
+{
+    RunParallelUpdate(state, 0);
+}
+
+TDME_BENCHMARK(Level, Update_Parallel_2Threads)
+{
+    RunParallelUpdate(state, 1);
+}
+
+TDME_BENCHMARK(Level, Update_Parallel_4Threads)
+{
+    RunParallelUpdate(state, 3);
+}
+
+TDME_BENCHMARK(Level, Update_Parallel_8Threads)
+{
+    RunParallelUpdate(state, 7);
+}
+
+TDME_BENCHMARK(Level, Update_Parallel_16Threads)
+{
+    RunParallelUpdate(state, 15);
+}
+
+// 프레임마다 Actor 1000 개를 스폰하고 모두 삭제 (ns/op 는 Actor 한 개의 스폰 + 삭제)
+TDME_BENCHMARK(Level, SpawnDestroy_Churn)
+{
+    Level                          level;
+    std::vector<AProjectileActor*> actors(ChurnActorCount);
+
+    state.Run(ChurnActorCount, [&] {
+        for (AProjectileActor*& actor : actors)
+        {
+            actor = level.SpawnActor<AProjectileActor>();
+        }
+        for (AProjectileActor* actor : actors)
+        {
+            level.DestroyActor(actor);
+        }
+        level.Update(0.0f);
+        ClobberMemory();
+    });
+}
+
+// Actor 100k 개가 있는 Level 에서 프레임마다 1000 개를 스폰하고 이전 프레임에 스폰한 1000 개를 삭제 (구조 변경이 전체 노드 수에 비례하지 않는지)
+TDME_BENCHMARK(Level, SpawnDestroy_Churn_Populated)
+{
+    Level level;
+    for (size_t i = 0; i < LevelActorCount; i++)
+    {
+        level.SpawnActor<AProjectileActor>();
+    }
+    level.Update(0.0f);
+
+    std::vector<AProjectileActor*> actors(ChurnActorCount);
+    for (AProjectileActor*& actor : actors)
+    {
+        actor = level.SpawnActor<AProjectileActor>();
+    }
+
+    state.Run(ChurnActorCount, [&] {
+        for (AProjectileActor*& actor : actors)
+        {
+            level.DestroyActor(actor);
+            actor = level.SpawnActor<AProjectileActor>();
+        }
+        level.Update(0.0f);
+        ClobberMemory();
+    });
+}
+
+// SpawnDestroy_Churn 과 같은 스폰 / 삭제를 지연 명령 버퍼에 기록한 뒤 재생 (직접 호출 대비 기록 / 정렬 / 재생 비용)
+TDME_BENCHMARK(Level, SpawnDestroy_Churn_Deferred)
+{
+    Level                          level;
+    LevelCommandBuffer&            commands = level.GetCommandBuffer();
+    std::vector<AProjectileActor*> actors(ChurnActorCount);
+
+    state.Run(ChurnActorCount, [&] {
+        for (size_t i = 0; i < ChurnActorCount; i++)
+        {
+            AProjectileActor** slot = &actors[i];
+            commands.SpawnActor<AProjectileActor>(i, [slot](AProjectileActor& actor) { *slot = &actor; });
+        }
+        level.FlushCommands();
+
+        for (size_t i = 0; i < ChurnActorCount; i++)
+        {
+            commands.DestroyActor(i, actors[i]);
+        }
+        level.Update(0.0f);
+        ClobberMemory();
+    });
+}
+
+// 빈 Level 에 투사체 50k 개를 SpawnActor 로 하나씩 생성 (레벨 로드, ns/op 는 Actor 한 개당, Level 소멸 포함)
+TDME_BENCHMARK(Level, SpawnActor_Loop_50k)
+{
+    state.Run(BulkSpawnCount, [&] {
+        Level level;
+        for (size_t i = 0; i < BulkSpawnCount; i++)
+        {
+            level.SpawnActor<AProjectileActor>();
+        }
+        ClobberMemory();
+    });
+}
+
+// SpawnActor_Loop_50k 와 같은 작업을 SpawnActors 한 번으로 생성 (용량 확보 + 연속 생성 + BeginPlay 일괄 호출)
+TDME_BENCHMARK(Level, SpawnActors_Bulk_50k)
+{
+    state.Run(BulkSpawnCount, [&] {
+        Level level;
+        level.SpawnActors<AProjectileActor>(static_cast<uint32>(BulkSpawnCount));
+        ClobberMemory();
+    });
+}
+
+// Actor 100k 개가 있는 Level 에서 투사체 10k 개가 한 프레임에 모두 삭제 (ns/op 는 삭제되는 Actor 한 개당, 스폰 포함)
+TDME_BENCHMARK(Level, DestroyWave)
+{
+    Level level;
+    for (size_t i = 0; i < LevelActorCount; i++)
+    {
+        level.SpawnActor<AIdleActor>();
+    }
+
+    std::vector<AProjectileActor*> wave(WaveActorCount);
+    state.Run(WaveActorCount, [&] {
+        for (AProjectileActor*& actor : wave)
+        {
+            actor = level.SpawnActor<AProjectileActor>();
+        }
+        for (AProjectileActor* actor : wave)
+        {
+            level.DestroyActor(actor);
+        }
+        level.Update(0.0f);
+        ClobberMemory();
+    });
+}
+
+// 절반이 삭제된 Actor 100k 개의 핸들 조회 (ns/op 는 핸들 한 개당)
+TDME_BENCHMARK(Level, ResolveHandles_HalfStale)
+{
+    Level                             level;
+    std::vector<ObjectHandle<AActor>> handles;
+    handles.reserve(LevelActorCount);
+    for (size_t i = 0; i < LevelActorCount; i++)
+    {
+        AIdleActor* actor = level.SpawnActor<AIdleActor>();
+        handles.emplace_back(actor);
+        if (i % 2 == 0)
+        {
+            level.DestroyActor(actor);
+        }
+    }
+    level.Update(0.0f);
+
+    uint32 aliveCount = 0;
+    state.Run(LevelActorCount, [&] {
+        aliveCount = 0;
+        for (const ObjectHandle<AActor>& handle : handles)
+        {
+            aliveCount += level.Resolve(handle) != nullptr;
+        }
+        DoNotOptimize(aliveCount);
+    });
+
+    state.SetCounter("Alive", static_cast<double>(aliveCount));
+}
\ No newline at end of file
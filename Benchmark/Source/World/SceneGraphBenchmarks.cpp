@@ -0,0 +1,227 @@
+#include "pch.h"
+#include "Benchmark/BenchmarkData.h"
+
+#include "Engine/Object/Actor/AActor.h"
+#include "Engine/Object/Component/GSceneComponent.h"
+#include "Engine/World/Level.h"
+
+using namespace TDME;
+using namespace TDME::Benchmark;
+
+namespace
+{
+    constexpr size_t SubtreeNodeCount = 10000; // 서브트리 하나의 노드 수
+    constexpr size_t SubtreeCount     = 4;     // 매 프레임 움직이는 서브트리 수
+    constexpr size_t TreeFanOut       = 4;     // 트리 형태 서브트리의 자식 수 (깊이 약 7)
+
+    /**
+     * @brief SceneComponent 서브트리 하나를 소유하는 Actor
+     * @details fanOut 이 0 이면 한 줄로 이어진 체인 (APlanet 공전 체인의 극단적인 경우), 아니면 fanOut 진 트리
+     */
+    class ASubtreeActor : public AActor
+    {
+    public:
+        ASubtreeActor(size_t nodeCount, size_t fanOut, EComponentMobility mobility = EComponentMobility::Movable)
+        {
+            BenchmarkRandom random;
+
+            Nodes.reserve(nodeCount);
+            for (size_t i = 0; i < nodeCount; i++)
+            {
+                GSceneComponent* node = AddComponent<GSceneComponent>(i == 0);
+                node->SetMobility(mobility);
+                if (i > 0)
+                {
+                    node->AttachToComponent(Nodes[fanOut ? (i - 1) / fanOut : i - 1]);
+                }
+
+                node->SetPosition(random.NextVector3(-1.0f, 1.0f));
+                node->SetRotation(random.NextUnitQuaternion());
+                Nodes.push_back(node);
+            }
+        }
+
+        std::vector<GSceneComponent*> Nodes;
+    };
+
+    /**
+     * @brief 서브트리 루트를 프레임마다 다른 위치로 이동
+     */
+    void MoveRoots(const std::vector<ASubtreeActor*>& actors, size_t frame)
+    {
+        const float offset = float(frame & 0xFF) * 0.01f;
+        for (ASubtreeActor* actor : actors)
+        {
+            actor->Nodes[0]->SetPosition(Vector3(offset, 0.0f, -offset));
+        }
+    }
+
+    /**
+     * @brief 모든 노드의 World Matrix 를 읽어 합산 (렌더러의 상수 버퍼 업로드를 흉내)
+     */
+    float ReadAllWorldMatrices(const std::vector<ASubtreeActor*>& actors)
+    {
+        float sum = 0.0f;
+        for (ASubtreeActor* actor : actors)
+        {
+            for (const GSceneComponent* node : actor->Nodes)
+            {
+                sum += node->GetWorldMatrix3x4().Tx;
+            }
+        }
+        return sum;
+    }
+
+    /**
+     * @brief Level 에 등록하지 않은 (지연 계산 경로) 서브트리 생성
+     */
+    std::vector<std::unique_ptr<ASubtreeActor>> CreateStandaloneSubtrees(size_t fanOut)
+    {
+        std::vector<std::unique_ptr<ASubtreeActor>> owners;
+        for (size_t i = 0; i < SubtreeCount; i++)
+        {
+            owners.push_back(std::make_unique<ASubtreeActor>(SubtreeNodeCount, fanOut));
+        }
+        return owners;
+    }
+
+    std::vector<ASubtreeActor*> GetPointers(const std::vector<std::unique_ptr<ASubtreeActor>>& owners)
+    {
+        std::vector<ASubtreeActor*> actors;
+        for (const std::unique_ptr<ASubtreeActor>& owner : owners)
+        {
+            actors.push_back(owner.get());
+        }
+        return actors;
+    }
+
+    std::vector<ASubtreeActor*> SpawnSubtrees(Level& level, size_t fanOut, EComponentMobility mobility = EComponentMobility::Movable)
+    {
+        std::vector<ASubtreeActor*> actors;
+        for (size_t i = 0; i < SubtreeCount; i++)
+        {
+            actors.push_back(level.SpawnActor<ASubtreeActor>(SubtreeNodeCount, fanOut, mobility));
+        }
+        level.Update(0.0f);
+        return actors;
+    }
+} // namespace
+
+//////////////////////////////////////////////////////////////
+// SceneGraph (10k 노드 서브트리의 루트를 매 프레임 이동)
+//////////////////////////////////////////////////////////////
+
+// 루트 이동 후 잎 노드 하나만 읽음 (부모 체인만 재계산)
+TDME_BENCHMARK(SceneGraph, MoveRoot_ReadLeaf)
+{
+    const auto                        owners = CreateStandaloneSubtrees(TreeFanOut);
+    const std::vector<ASubtreeActor*> actors = GetPointers(owners);
+    size_t                            frame  = 0;
+
+    state.Run(SubtreeCount, [&] {
+        MoveRoots(actors, frame++);
+        for (ASubtreeActor* actor : actors)
+        {
+            DoNotOptimize(actor->Nodes.back()->GetWorldMatrix3x4());
+        }
+    });
+}
+
+// 루트 이동 후 모든 노드 읽기 (지연 계산 경로, 트리)
+TDME_BENCHMARK(SceneGraph, MoveRoot_ReadAll_Tree)
+{
+    const auto                        owners = CreateStandaloneSubtrees(TreeFanOut);
+    const std::vector<ASubtreeActor*> actors = GetPointers(owners);
+    size_t                            frame  = 0;
+
+    state.Run(SubtreeCount * SubtreeNodeCount, [&] {
+        MoveRoots(actors, frame++);
+        DoNotOptimize(ReadAllWorldMatrices(actors));
+    });
+}
+
+// 루트 이동 후 모든 노드 읽기 (지연 계산 경로, 10k 깊이 체인)
+TDME_BENCHMARK(SceneGraph, MoveRoot_ReadAll_Chain)
+{
+    const auto                        owners = CreateStandaloneSubtrees(0);
+    const std::vector<ASubtreeActor*> actors = GetPointers(owners);
+    size_t                            frame  = 0;
+
+    state.Run(SubtreeCount * SubtreeNodeCount, [&] {
+        MoveRoots(actors, frame++);
+        DoNotOptimize(ReadAllWorldMatrices(actors));
+    });
+}
+
+// Level 의 TransformHierarchy 일괄 갱신 후 모든 노드 읽기 (트리)
+TDME_BENCHMARK(SceneGraph, LevelUpdate_ReadAll_Tree)
+{
+    Level                             level;
+    const std::vector<ASubtreeActor*> actors = SpawnSubtrees(level, TreeFanOut);
+    size_t                            frame  = 0;
+
+    state.Run(SubtreeCount * SubtreeNodeCount, [&] {
+        MoveRoots(actors, frame++);
+        level.Update(0.016f);
+        DoNotOptimize(ReadAllWorldMatrices(actors));
+    });
+}
+
+// Level 의 TransformHierarchy 일괄 갱신 후 모든 노드 읽기 (10k 깊이 체인)
+TDME_BENCHMARK(SceneGraph, LevelUpdate_ReadAll_Chain)
+{
+    Level                             level;
+    const std::vector<ASubtreeActor*> actors = SpawnSubtrees(level, 0);
+    size_t                            frame  = 0;
+
+    state.Run(SubtreeCount * SubtreeNodeCount, [&] {
+        MoveRoots(actors, frame++);
+        level.Update(0.016f);
+        DoNotOptimize(ReadAllWorldMatrices(actors));
+    });
+}
+
+// 움직이지 않는 서브트리의 Level 갱신 + 모든 노드 읽기 (Movable: 매 프레임 버전 비교 / Static: Bake 되어 순회 제외)
+TDME_BENCHMARK(SceneGraph, LevelUpdate_Idle_Movable)
+{
+    Level                             level;
+    const std::vector<ASubtreeActor*> actors = SpawnSubtrees(level, TreeFanOut, EComponentMobility::Movable);
+
+    state.Run(SubtreeCount * SubtreeNodeCount, [&] {
+        level.Update(0.016f);
+        DoNotOptimize(ReadAllWorldMatrices(actors));
+    });
+}
+
+TDME_BENCHMARK(SceneGraph, LevelUpdate_Idle_Static)
+{
+    Level                             level;
+    const std::vector<ASubtreeActor*> actors = SpawnSubtrees(level, TreeFanOut, EComponentMobility::Static);
+
+    state.Run(SubtreeCount * SubtreeNodeCount, [&] {
+        level.Update(0.016f);
+        DoNotOptimize(ReadAllWorldMatrices(actors));
+    });
+}
+
+// 자식 10k 개를 가진 부모에서 임의의 자식을 분리 후 다시 부착 (ComponentBytes: 컴포넌트 한 개의 크기)
+TDME_BENCHMARK(SceneGraph, ReattachChild_WideParent)
+{
+    GSceneComponent                              parent;
+    std::vector<std::unique_ptr<GSceneComponent>> children;
+    for (size_t i = 0; i < SubtreeNodeCount; i++)
+    {
+        children.push_back(std::make_unique<GSceneComponent>());
+        children.back()->AttachToComponent(&parent);
+    }
+
+    size_t next = 0;
+    state.Run(1, [&] {
+        GSceneComponent* child = children[next].get();
+        next                   = (next + 7919) % SubtreeNodeCount; // 부모의 자식 목록 여러 위치에서 분리되도록 소수 간격
+        child->DetachFromParent();
+        child->AttachToComponent(&parent);
+    });
+
+    state.SetCounter("ComponentBytes", double(sizeof(GSceneComponent)));
+}
\ No newline at end of file
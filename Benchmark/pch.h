@@ -0,0 +1,25 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////
+// C++ 표준 라이브러리
+//////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////
+// Core 헤더
+//////////////////////////////////////////////////////////////
+
+#include "Core/CoreMacros.h"
+#include "Core/Math/MathConstants.h"
+#include "Core/CoreTypes.h"
+
+//////////////////////////////////////////////////////////////
+// Benchmark 헤더
+//////////////////////////////////////////////////////////////
+
+#include "Benchmark/Benchmark.h"
\ No newline at end of file
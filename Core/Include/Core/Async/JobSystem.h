@@ -0,0 +1,260 @@
+#pragma once
+
+#include "Core/Async/WorkStealingDeque.h"
+#include "Core/CoreTypes.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace TDME
+{
+    /**
+     * @brief 작업 함수 ([begin, end) 구간 실행, 구간이 필요 없는 작업은 0, 0)
+     */
+    using JobFunction = void (*)(void* context, uint32 begin, uint32 end);
+
+    /**
+     * @brief 작업 카운터 (작업 묶음의 완료 대기용 펜스)
+     * @details JobSystem::Run 이 작업마다 1 씩 올리고 작업이 끝나면 1 씩 내림. JobSystem::Wait 로 0 이 될 때까지 대기
+     * @note 기다리는 작업이 모두 끝날 때까지 카운터를 소멸시키지 말 것
+     */
+    class JobCounter
+    {
+    public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter&)            = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        /**
+         * @brief 연결된 작업이 모두 끝났는지 여부 (true 면 작업의 결과를 읽어도 됨)
+         */
+        [[nodiscard]] bool IsDone() const { return m_pendingCount.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32> m_pendingCount{ 0 };
+    };
+
+    /**
+     * @brief 작업 훔치기(Work Stealing) 기반 작업 시스템
+     * @details 스레드마다 Chase-Lev 덱을 하나씩 두고, 각 스레드는 자기 덱에 작업을 넣고 꺼내며(LIFO) 비면 다른 스레드의 덱에서 훔쳐 옴(FIFO).
+     * @li 메인 스레드(JobSystem 을 생성한 스레드)도 덱을 가지며, Wait 중에는 대기하지 않고 작업을 실행
+     * @li 작업 스레드 안에서 Run / ParallelFor / Wait 를 호출해도 됨 (기다리는 동안 다른 작업을 실행하므로 교착되지 않음)
+     * @li 등록되지 않은 다른 스레드에서 넣은 작업은 뮤텍스로 보호되는 공용 큐를 거침
+     * @li 일이 없는 작업 스레드는 잠깐 훔치기를 시도한 뒤 조건 변수로 잠들고, 새 작업이 들어오면 깨어남
+     * @note Engine(Level Tick, 컬링, 메시 생성)과 Core(이미지 디코드 등) 어디서든 사용할 수 있도록 Core 에만 의존
+     * @code
+     * JobCounter counter;
+     * for (Image& image : images)
+     * {
+     *     jobSystem.Run([](void* context, uint32, uint32) { Decode(*static_cast<Image*>(context)); }, &image, counter);
+     * }
+     * jobSystem.Wait(counter); // 메인 스레드도 디코드 작업을 나누어 실행
+     * @endcode
+     */
+    class JobSystem
+    {
+    public:
+        static constexpr uint32 InvalidThreadIndex = ~0u;
+
+        /**
+         * @brief 작업 스레드 생성 (생성한 스레드를 메인 스레드로 등록)
+         * @param workerCount 작업 스레드 수 (메인 스레드 제외, 기본값은 하드웨어 스레드 수 - 1)
+         */
+        explicit JobSystem(uint32 workerCount = GetDefaultWorkerCount());
+
+        /**
+         * @brief 작업 스레드 종료
+         * @note 실행 중이거나 대기 중인 작업이 없어야 함 (모든 카운터를 먼저 Wait 할 것)
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem&)            = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        //////////////////////////////////////////////////////////////
+        // 작업 실행
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 작업 하나를 큐에 추가
+         * @param function 작업 함수
+         * @param context 작업 함수에 전달할 데이터 (작업이 끝날 때까지 유효해야 함)
+         * @param counter 완료를 알릴 카운터
+         * @param begin 작업 함수에 전달할 구간 시작
+         * @param end 작업 함수에 전달할 구간 끝
+         */
+        void Run(JobFunction function, void* context, JobCounter& counter, uint32 begin = 0, uint32 end = 0);
+
+        /**
+         * @brief 호출 가능 객체 하나를 작업으로 추가
+         * @tparam Func void() 형태의 호출 가능 객체 (작업이 끝날 때까지 유효해야 하므로 복사하지 않고 주소만 전달)
+         */
+        template <typename Func>
+        void Run(Func& func, JobCounter& counter)
+        {
+            Run([](void* context, uint32, uint32) { (*static_cast<Func*>(context))(); }, &func, counter);
+        }
+
+        /**
+         * @brief 카운터의 작업이 모두 끝날 때까지 대기
+         * @details 기다리는 동안 현재 스레드도 자기 덱 / 공용 큐 / 다른 스레드의 덱에서 작업을 가져와 실행
+         */
+        void Wait(JobCounter& counter);
+
+        /**
+         * @brief [0, count) 구간을 나누어 병렬 실행 (모두 끝날 때까지 대기)
+         * @details 구간을 절반씩 나누어 뒤쪽 절반을 덱에 넣고 앞쪽을 계속 나누므로, 다른 스레드는 가장 큰 남은 구간을 훔쳐 감.
+         *          먼저 끝난 스레드가 남은 구간을 다시 나누어 가져가므로 항목마다 비용이 달라도 부하가 분산됨
+         * @tparam Func void(uint32 begin, uint32 end) 형태의 호출 가능 객체
+         * @param count 전체 항목 수
+         * @param grainSize 더 이상 나누지 않을 구간 크기 (0 이면 스레드당 구간 8 개 정도가 되도록 자동 결정)
+         * @param func 구간 실행 함수
+         * @code
+         * jobSystem.ParallelFor(count, 0, [&](uint32 begin, uint32 end) {
+         *     for (uint32 i = begin; i < end; i++) { ... }
+         * });
+         * @endcode
+         */
+        template <typename Func>
+        void ParallelFor(uint32 count, uint32 grainSize, Func&& func)
+        {
+            using FuncType = std::remove_reference_t<Func>;
+            ParallelFor(count, grainSize, [](void* context, uint32 begin, uint32 end) { (*static_cast<FuncType*>(context))(begin, end); }, &func);
+        }
+
+        /**
+         * @brief [0, count) 구간을 나누어 병렬 실행 (함수 포인터 버전)
+         */
+        void ParallelFor(uint32 count, uint32 grainSize, JobFunction function, void* context);
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 작업 스레드 수 반환 (메인 스레드 제외)
+         */
+        [[nodiscard]] uint32 GetWorkerCount() const { return static_cast<uint32>(m_workers.size()); }
+
+        /**
+         * @brief 작업을 실행하는 전체 스레드 수 반환 (작업 스레드 + 메인 스레드)
+         */
+        [[nodiscard]] uint32 GetThreadCount() const { return GetWorkerCount() + 1; }
+
+        /**
+         * @brief 기본 작업 스레드 수 반환 (하드웨어 스레드 수 - 1, 메인 스레드 몫 제외)
+         */
+        [[nodiscard]] static uint32 GetDefaultWorkerCount();
+
+        /**
+         * @brief 현재 스레드의 이 시스템 내 인덱스 반환 (0 = 메인 스레드, 1 ~ GetWorkerCount() = 작업 스레드)
+         * @details 스레드별 데이터(명령 버퍼, 누적 버퍼 등)를 잠금 없이 나누어 쓰는 데 사용
+         * @return uint32 이 시스템에 등록되지 않은 스레드면 InvalidThreadIndex
+         */
+        [[nodiscard]] uint32 GetCurrentThreadIndex() const;
+
+    private:
+        /**
+         * @brief 큐에 들어간 작업
+         */
+        struct Job
+        {
+            JobFunction Function;
+            void*       Context;
+            uint32      Begin;
+            uint32      End;
+            JobCounter* Counter;
+            Job*        Next;       // 풀의 빈 작업 목록 연결
+            uint32      OwnerIndex; // 작업을 할당한 풀의 인덱스 (해제할 때 돌려줄 곳)
+        };
+
+        /**
+         * @brief 스레드별 작업 풀 (작업마다 전역 힙을 거치지 않도록 덩어리 단위로 할당해 재사용)
+         * @details 할당과 같은 스레드의 해제는 FreeJobs 만 사용하므로 잠금이 없고,
+         *          다른 스레드가 훔쳐 가 실행한 작업은 ReturnedJobs 에 CAS 로 넣어 돌려줌.
+         *          주인 스레드는 FreeJobs 가 비면 ReturnedJobs 를 통째로 가져오므로 ABA 가 생기지 않음
+         * @note 마지막 풀은 등록되지 않은 스레드용으로, 할당은 m_injectMutex 아래에서 함
+         */
+        struct alignas(64) JobPool
+        {
+            Job*                                FreeJobs = nullptr;
+            std::atomic<Job*>                   ReturnedJobs{ nullptr };
+            std::vector<std::unique_ptr<Job[]>> Chunks;
+        };
+
+        /**
+         * @brief ParallelFor 의 구간 분할 작업 데이터 (ParallelFor 가 끝날 때까지 호출 스레드의 스택에 있음)
+         */
+        struct ParallelForContext
+        {
+            JobSystem*  System;
+            JobFunction Function;
+            void*       Context;
+            uint32      GrainSize;
+            JobCounter* Counter;
+        };
+
+        /**
+         * @brief 작업 스레드 루프 (작업을 찾아 실행하고, 없으면 잠듦)
+         * @param threadIndex 스레드 인덱스 (1 부터, 0 은 메인 스레드)
+         */
+        void WorkerMain(uint32 threadIndex);
+
+        /**
+         * @brief 실행할 작업 찾기 (자기 덱 → 공용 큐 → 다른 스레드의 덱 순서)
+         * @param threadIndex 현재 스레드 인덱스 (등록되지 않은 스레드면 InvalidThreadIndex)
+         * @return Job* 없으면 nullptr
+         */
+        Job* FindJob(uint32 threadIndex);
+
+        /**
+         * @brief 현재 스레드의 풀에서 작업 할당
+         * @param threadIndex 현재 스레드 인덱스 (등록되지 않은 스레드면 InvalidThreadIndex, m_injectMutex 를 잡고 호출)
+         */
+        Job* AllocateJob(uint32 threadIndex);
+
+        /**
+         * @brief 작업을 할당한 풀로 돌려줌 (같은 스레드면 빈 목록에 바로, 다른 스레드면 ReturnedJobs 로)
+         */
+        void FreeJob(Job* job, uint32 threadIndex);
+
+        /**
+         * @brief 작업 해제 후 실행하고 카운터를 내림 (실행 중에 추가되는 작업이 해제된 자리를 다시 쓸 수 있도록 먼저 해제)
+         */
+        void Execute(Job* job, uint32 threadIndex);
+
+        /**
+         * @brief 구간을 절반씩 나누어 뒤쪽을 작업으로 추가하고 남은 앞쪽 구간 실행 (ParallelFor 전용 작업 함수)
+         */
+        static void RunParallelForRange(void* context, uint32 begin, uint32 end);
+
+        static constexpr uint32 DequeCapacity      = 4096; // 가득 차면 넣으려던 작업을 바로 실행
+        static constexpr uint32 IdleSpinCount      = 64;   // 잠들기 전에 작업 찾기를 다시 시도하는 횟수
+        static constexpr uint32 JobChunkSize       = 256;  // 풀이 비었을 때 한 번에 할당하는 작업 수
+
+        std::vector<std::unique_ptr<WorkStealingDeque<Job*>>> m_deques; // [0] = 메인 스레드, [1 ~] = 작업 스레드
+        std::vector<std::unique_ptr<JobPool>>                 m_jobPools; // 덱과 같은 인덱스, 마지막은 등록되지 않은 스레드용
+        std::vector<std::thread>                              m_workers;
+
+        // 등록되지 않은 스레드에서 넣은 작업
+        std::mutex          m_injectMutex;
+        std::deque<Job*>    m_injectedJobs;
+        std::atomic<uint32> m_injectedCount{ 0 };
+
+        // 작업 스레드 재우기 / 깨우기 (작업이 추가될 때마다 세대를 올리고, 잠든 스레드가 있을 때만 알림)
+        std::mutex              m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+        std::atomic<uint32>     m_workGeneration{ 0 };
+        std::atomic<uint32>     m_sleepingCount{ 0 };
+        std::atomic<bool>       m_isStopping{ false };
+    };
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Core/CoreTypes.h"
+
+#include <atomic>
+#include <memory>
+
+namespace TDME
+{
+    /**
+     * @brief Chase-Lev 작업 훔치기 덱 (고정 용량)
+     * @details 소유 스레드 하나만 아래쪽(bottom)에서 Push / Pop (LIFO, 캐시에 남아 있는 최근 작업부터 실행)하고,
+     *          다른 스레드는 위쪽(top)에서 Steal (FIFO, 가장 오래된 = 보통 가장 큰 작업을 가져감).
+     * @li 소유 스레드의 Push / Pop 은 마지막 하나를 두고 경쟁할 때만 CAS 를 사용하고, Steal 은 top 에 CAS 한 번
+     * @li 메모리 순서는 Lê et al. "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013) 를 따름
+     * @tparam T 요소 타입 (포인터 등 원자적으로 읽고 쓸 수 있는 타입, 빈 값은 T{})
+     * @note 용량을 늘리지 않으므로 가득 차면 Push 가 실패함 (호출한 쪽에서 바로 실행하는 등으로 처리)
+     */
+    template <typename T>
+    class WorkStealingDeque
+    {
+    public:
+        /**
+         * @brief 덱 생성
+         * @param capacity 용량 (2 의 거듭제곱으로 올림)
+         */
+        explicit WorkStealingDeque(uint32 capacity)
+        {
+            uint32 powerOfTwo = 1;
+            while (powerOfTwo < capacity)
+            {
+                powerOfTwo <<= 1;
+            }
+
+            m_capacity = powerOfTwo;
+            m_mask     = powerOfTwo - 1;
+            m_buffer   = std::make_unique<std::atomic<T>[]>(powerOfTwo);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&)            = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * @brief 아래쪽에 추가 (소유 스레드 전용)
+         * @return bool 가득 차서 추가하지 못했으면 false
+         */
+        bool Push(T item)
+        {
+            const int64 bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64 top    = m_top.load(std::memory_order_acquire);
+            if (bottom - top >= static_cast<int64>(m_capacity))
+                return false;
+
+            m_buffer[bottom & m_mask].store(item, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_release); // 요소를 쓴 뒤에 공개
+            return true;
+        }
+
+        /**
+         * @brief 아래쪽에서 꺼냄 (소유 스레드 전용, 최근에 넣은 것부터)
+         * @return T 비어 있거나 마지막 요소를 Steal 에 뺏겼으면 T{}
+         */
+        T Pop()
+        {
+            const int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst); // bottom 감소를 Steal 의 top 읽기보다 먼저 보이게 함
+
+            int64 top = m_top.load(std::memory_order_relaxed);
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed); // 비어 있음
+                return T{};
+            }
+
+            T item = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // 마지막 요소: Steal 과 같은 요소를 두고 경쟁하므로 top 을 CAS 로 가져감
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    item = T{};
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /**
+         * @brief 위쪽에서 훔침 (다른 스레드용, 가장 오래된 것부터)
+         * @return T 비어 있거나 다른 스레드와의 경쟁에서 졌으면 T{}
+         */
+        T Steal()
+        {
+            int64 top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64 bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+                return T{};
+
+            T item = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return T{};
+
+            return item;
+        }
+
+        /**
+         * @brief 대략적인 요소 수 반환 (다른 스레드가 동시에 변경하면 근사값)
+         */
+        [[nodiscard]] uint32 GetApproximateSize() const
+        {
+            const int64 size = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+            return size > 0 ? static_cast<uint32>(size) : 0;
+        }
+
+    private:
+        // top 과 bottom 은 서로 다른 스레드가 주로 쓰므로 다른 캐시 라인에 둠
+        alignas(64) std::atomic<int64> m_top{ 0 };
+        alignas(64) std::atomic<int64> m_bottom{ 0 };
+
+        std::unique_ptr<std::atomic<T>[]> m_buffer;
+        uint32                            m_capacity = 0;
+        uint32                            m_mask     = 0;
+    };
+} // namespace TDME
\ No newline at end of file
@@ -69,4 +69,64 @@
     #define RESTRICT __restrict__
 #else
     #define RESTRICT
+#endif
+
+//////////////////////////////////////////////////////////////
+// 검사 매크로
+//////////////////////////////////////////////////////////////
+
+/**
+ * @brief 디버그 빌드 전용 검사 (조건이 거짓이면 메시지와 함께 중단)
+ * @note NDEBUG 빌드에서는 조건식을 평가하지 않으므로 부작용이 있는 식을 넣지 말 것
+ */
+#ifdef NDEBUG
+    #define TDME_ASSERT(condition, message) ((void)0)
+#else
+    #include <cassert>
+    #define TDME_ASSERT(condition, message) assert((condition) && (message))
+#endif
+
+//////////////////////////////////////////////////////////////
+// SIMD 명령어 세트 감지
+//////////////////////////////////////////////////////////////
+
+/**
+ * @brief 컴파일 타임 SIMD 백엔드 선택
+ * @details 컴파일러 옵션(/arch:AVX, -mavx 등)에 따라 사용 가능한 명령어 세트를 감지.
+ * @note TDME_SIMD_DISABLE 를 정의하면 모든 SIMD 경로를 끄고 스칼라 구현으로 폴백.
+ */
+#if !defined(TDME_SIMD_DISABLE)
+    #if defined(__AVX2__)
+        #define TDME_SIMD_AVX2 1
+    #endif
+    #if defined(__AVX__)
+        #define TDME_SIMD_AVX 1
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define TDME_SIMD_SSE 1
+    #endif
+#endif
+
+#ifndef TDME_SIMD_AVX2
+    #define TDME_SIMD_AVX2 0
+#endif
+#ifndef TDME_SIMD_AVX
+    #define TDME_SIMD_AVX 0
+#endif
+#ifndef TDME_SIMD_SSE
+    #define TDME_SIMD_SSE 0
+#endif
+
+//////////////////////////////////////////////////////////////
+// 근사 삼각함수 사용 여부
+//////////////////////////////////////////////////////////////
+
+/**
+ * @brief 엔진 내부 삼각함수 호출을 다항식 근사(Math::FastSinCos / FastAtan2)로 대체
+ * @details 1 로 정의하면 Math::SinCos / Math::Atan2 를 거치는 메시 생성기(구, 원)와
+ *          쿼터니언 생성 함수(FromAxisAngle, FromEuler, FromRotationX/Y/Z), Transform::GetRotation2D 가 근사 함수를 사용.
+ * @note 기본값 0 (표준 라이브러리 std::sin / std::cos / std::atan2 사용). 오차 범위는 MathUtils.h 참고.
+ */
+#ifndef TDME_FAST_TRIG
+    #define TDME_FAST_TRIG 0
 #endif
\ No newline at end of file
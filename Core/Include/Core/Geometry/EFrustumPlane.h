@@ -0,0 +1,20 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+namespace TDME
+{
+    /**
+     * @brief 절두체 평면 인덱스 (TFrustum::Planes 순서)
+     */
+    enum class EFrustumPlane : uint8
+    {
+        Left,   // 왼쪽
+        Right,  // 오른쪽
+        Bottom, // 아래쪽
+        Top,    // 위쪽
+        Near,   // 근접 평면
+        Far,    // 원근 평면
+        Count,  // 평면 개수
+    };
+} // namespace TDME
\ No newline at end of file
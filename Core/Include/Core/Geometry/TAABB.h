@@ -0,0 +1,225 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/Math/MathUtils.h>
+#include <Core/Math/TMatrix4x4.h>
+#include <Core/Math/TVector3.h>
+
+#include <cmath>
+#include <limits>
+
+namespace TDME
+{
+    /**
+     * @brief 축 정렬 경계 상자 (Axis-Aligned Bounding Box)
+     * @details Min/Max 두 꼭짓점으로 표현. Min > Max 인 축이 있으면 비어 있는 상자로 취급.
+     * @tparam T 요소 타입
+     */
+    template <typename T>
+    struct TAABB
+    {
+        TVector3<T> Min;
+        TVector3<T> Max;
+
+        //////////////////////////////////////////////////////////////
+        // 생성자
+        //////////////////////////////////////////////////////////////
+
+        constexpr TAABB() : Min(T(0)), Max(T(0)) {}
+
+        constexpr TAABB(const TVector3<T>& min, const TVector3<T>& max) : Min(min), Max(max) {}
+
+        /**
+         * @brief 중심과 반 크기(Extents)로 상자 생성
+         * @param center 중심
+         * @param extents 각 축의 반 크기
+         */
+        static constexpr TAABB FromCenterExtents(const TVector3<T>& center, const TVector3<T>& extents)
+        {
+            return TAABB(center - extents, center + extents);
+        }
+
+        /**
+         * @brief 점 배열을 모두 포함하는 최소 상자 생성
+         * @param points 점 배열
+         * @param count 점 개수
+         * @return TAABB 점이 없으면 Empty()
+         */
+        static constexpr TAABB FromPoints(const TVector3<T>* points, size_t count)
+        {
+            TAABB result = Empty();
+            for (size_t i = 0; i < count; i++)
+            {
+                result.Encapsulate(points[i]);
+            }
+            return result;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 중심 반환
+         * @return TVector3<T> 중심점
+         */
+        constexpr TVector3<T> GetCenter() const
+        {
+            return (Min + Max) * T(0.5);
+        }
+
+        /**
+         * @brief 각 축의 반 크기 반환
+         * @return TVector3<T> 반 크기
+         */
+        constexpr TVector3<T> GetExtents() const
+        {
+            return (Max - Min) * T(0.5);
+        }
+
+        /**
+         * @brief 크기 반환
+         * @return TVector3<T> 각 축의 길이
+         */
+        constexpr TVector3<T> GetSize() const
+        {
+            return Max - Min;
+        }
+
+        /**
+         * @brief 유효한 상자인지 확인 (모든 축에서 Min <= Max)
+         * @return bool 유효한 상자인지 여부
+         */
+        constexpr bool IsValid() const
+        {
+            return Min.X <= Max.X && Min.Y <= Max.Y && Min.Z <= Max.Z;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 충돌 관련
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 점이 상자 내부에 있는지 확인
+         * @param point 검사할 점
+         */
+        constexpr bool Contains(const TVector3<T>& point) const
+        {
+            return point.X >= Min.X && point.X <= Max.X
+                && point.Y >= Min.Y && point.Y <= Max.Y
+                && point.Z >= Min.Z && point.Z <= Max.Z;
+        }
+
+        /**
+         * @brief 다른 상자가 완전히 내부에 있는지 확인
+         * @param other 검사할 상자
+         */
+        constexpr bool Contains(const TAABB& other) const
+        {
+            return other.Min.X >= Min.X && other.Max.X <= Max.X
+                && other.Min.Y >= Min.Y && other.Max.Y <= Max.Y
+                && other.Min.Z >= Min.Z && other.Max.Z <= Max.Z;
+        }
+
+        /**
+         * @brief 다른 상자와 겹치는지 확인
+         * @param other 검사할 상자
+         */
+        constexpr bool Intersects(const TAABB& other) const
+        {
+            return !(Max.X < other.Min.X || other.Max.X < Min.X
+                     || Max.Y < other.Min.Y || other.Max.Y < Min.Y
+                     || Max.Z < other.Min.Z || other.Max.Z < Min.Z);
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 변환
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 점을 포함하도록 상자 확장
+         * @param point 포함할 점
+         */
+        constexpr void Encapsulate(const TVector3<T>& point)
+        {
+            Min = TVector3<T>(Math::Min(Min.X, point.X), Math::Min(Min.Y, point.Y), Math::Min(Min.Z, point.Z));
+            Max = TVector3<T>(Math::Max(Max.X, point.X), Math::Max(Max.Y, point.Y), Math::Max(Max.Z, point.Z));
+        }
+
+        /**
+         * @brief 상자 확장 (모든 방향으로)
+         * @param amount 확장량
+         * @return TAABB 확장된 상자
+         */
+        constexpr TAABB Expanded(T amount) const
+        {
+            return TAABB(Min - TVector3<T>(amount), Max + TVector3<T>(amount));
+        }
+
+        /**
+         * @brief 두 상자의 합집합 (둘을 포함하는 최소 상자)
+         * @param other 다른 상자
+         * @return TAABB 합집합 상자
+         */
+        constexpr TAABB Union(const TAABB& other) const
+        {
+            return TAABB(TVector3<T>(Math::Min(Min.X, other.Min.X), Math::Min(Min.Y, other.Min.Y), Math::Min(Min.Z, other.Min.Z)),
+                         TVector3<T>(Math::Max(Max.X, other.Max.X), Math::Max(Max.Y, other.Max.Y), Math::Max(Max.Z, other.Max.Z)));
+        }
+
+        /**
+         * @brief 아핀 행렬로 변환한 상자를 다시 감싸는 축 정렬 상자
+         * @details 중심은 행렬로 변환하고, 반 크기는 |M| (3x3 성분의 절댓값) 으로 변환 (Arvo 방식)
+         * @param matrix 변환 행렬 (Row-vector 기준, 4번째 열 무시)
+         * @return TAABB 변환된 상자
+         */
+        INLINE TAABB Transformed(const TMatrix4x4<T>& matrix) const
+        {
+            const TVector3<T> c = GetCenter();
+            const TVector3<T> e = GetExtents();
+
+            const TVector3<T> center(c.X * matrix._11 + c.Y * matrix._21 + c.Z * matrix._31 + matrix._41,
+                                     c.X * matrix._12 + c.Y * matrix._22 + c.Z * matrix._32 + matrix._42,
+                                     c.X * matrix._13 + c.Y * matrix._23 + c.Z * matrix._33 + matrix._43);
+            const TVector3<T> extents(e.X * std::abs(matrix._11) + e.Y * std::abs(matrix._21) + e.Z * std::abs(matrix._31),
+                                      e.X * std::abs(matrix._12) + e.Y * std::abs(matrix._22) + e.Z * std::abs(matrix._32),
+                                      e.X * std::abs(matrix._13) + e.Y * std::abs(matrix._23) + e.Z * std::abs(matrix._33));
+            return FromCenterExtents(center, extents);
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 연산자 오버로딩
+        //////////////////////////////////////////////////////////////
+
+        constexpr bool operator==(const TAABB& other) const
+        {
+            return Min == other.Min && Max == other.Max;
+        }
+
+        constexpr bool operator!=(const TAABB& other) const
+        {
+            return !(*this == other);
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 미리 정의된 AABB
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 비어 있는 상자 (Encapsulate 로 점을 누적할 때 시작값)
+         */
+        static constexpr TAABB Empty()
+        {
+            return TAABB(TVector3<T>(std::numeric_limits<T>::max()), TVector3<T>(std::numeric_limits<T>::lowest()));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////
+    // 타입 별칭
+    //////////////////////////////////////////////////////////////
+
+    using AABBF = TAABB<float>;  // float 경계 상자
+    using AABBD = TAABB<double>; // double 경계 상자
+    using AABB  = AABBF;         // 기본 타입은 float
+
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/Geometry/TAABB.h>
+#include <Core/Math/MathUtils.h>
+#include <Core/Math/TMatrix4x4.h>
+#include <Core/Math/TVector3.h>
+
+#include <cmath>
+
+namespace TDME
+{
+    /**
+     * @brief 경계 구 (Bounding Sphere)
+     * @tparam T 요소 타입
+     */
+    template <typename T>
+    struct TBoundingSphere
+    {
+        TVector3<T> Center;
+        T           Radius;
+
+        //////////////////////////////////////////////////////////////
+        // 생성자
+        //////////////////////////////////////////////////////////////
+
+        constexpr TBoundingSphere() : Center(T(0)), Radius(T(0)) {}
+
+        constexpr TBoundingSphere(const TVector3<T>& center, T radius) : Center(center), Radius(radius) {}
+
+        /**
+         * @brief 상자를 감싸는 구 생성 (상자 중심, 대각선 절반을 반지름으로 사용)
+         * @param box 경계 상자
+         */
+        static INLINE TBoundingSphere FromAABB(const TAABB<T>& box)
+        {
+            return TBoundingSphere(box.GetCenter(), box.GetExtents().Length());
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 충돌 관련
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 점이 구 내부에 있는지 확인
+         * @param point 검사할 점
+         */
+        constexpr bool Contains(const TVector3<T>& point) const
+        {
+            return (point - Center).LengthSquared() <= Radius * Radius;
+        }
+
+        /**
+         * @brief 다른 구와 겹치는지 확인
+         * @param other 검사할 구
+         */
+        constexpr bool Intersects(const TBoundingSphere& other) const
+        {
+            const T radiusSum = Radius + other.Radius;
+            return (other.Center - Center).LengthSquared() <= radiusSum * radiusSum;
+        }
+
+        /**
+         * @brief 상자와 겹치는지 확인 (상자 위 최근접점까지의 거리로 판정)
+         * @param box 검사할 상자
+         */
+        constexpr bool Intersects(const TAABB<T>& box) const
+        {
+            const TVector3<T> closest(Math::Clamp(Center.X, box.Min.X, box.Max.X),
+                                      Math::Clamp(Center.Y, box.Min.Y, box.Max.Y),
+                                      Math::Clamp(Center.Z, box.Min.Z, box.Max.Z));
+            return (closest - Center).LengthSquared() <= Radius * Radius;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 변환
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 아핀 행렬로 변환한 구를 감싸는 구
+         * @details 중심은 행렬로 변환하고, 반지름은 3x3 행 길이 중 최댓값(최대 스케일)을 곱함
+         * @param matrix 변환 행렬 (Row-vector 기준, 4번째 열 무시)
+         * @return TBoundingSphere 변환된 구
+         */
+        INLINE TBoundingSphere Transformed(const TMatrix4x4<T>& matrix) const
+        {
+            const TVector3<T> center(Center.X * matrix._11 + Center.Y * matrix._21 + Center.Z * matrix._31 + matrix._41,
+                                     Center.X * matrix._12 + Center.Y * matrix._22 + Center.Z * matrix._32 + matrix._42,
+                                     Center.X * matrix._13 + Center.Y * matrix._23 + Center.Z * matrix._33 + matrix._43);
+
+            const T scaleSq = Math::Max(Math::Max(matrix._11 * matrix._11 + matrix._12 * matrix._12 + matrix._13 * matrix._13,
+                                                  matrix._21 * matrix._21 + matrix._22 * matrix._22 + matrix._23 * matrix._23),
+                                        matrix._31 * matrix._31 + matrix._32 * matrix._32 + matrix._33 * matrix._33);
+            return TBoundingSphere(center, Radius * std::sqrt(scaleSq));
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 연산자 오버로딩
+        //////////////////////////////////////////////////////////////
+
+        constexpr bool operator==(const TBoundingSphere& other) const
+        {
+            return Center == other.Center && Radius == other.Radius;
+        }
+
+        constexpr bool operator!=(const TBoundingSphere& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////
+    // 타입 별칭
+    //////////////////////////////////////////////////////////////
+
+    using BoundingSphereF = TBoundingSphere<float>;  // float 경계 구
+    using BoundingSphereD = TBoundingSphere<double>; // double 경계 구
+    using BoundingSphere  = BoundingSphereF;         // 기본 타입은 float
+
+} // namespace TDME
\ No newline at end of file
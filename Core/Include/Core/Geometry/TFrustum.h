@@ -0,0 +1,240 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/Geometry/EFrustumPlane.h>
+#include <Core/Geometry/TAABB.h>
+#include <Core/Geometry/TBoundingSphere.h>
+#include <Core/Geometry/TPlane.h>
+#include <Core/Math/TMatrix4x4.h>
+#include <Core/Math/TVector3.h>
+#include <Core/Math/SIMD/FrustumSIMD.h>
+
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace TDME
+{
+    /**
+     * @brief 절두체 (View Frustum)
+     * @details 6개 평면의 법선이 모두 절두체 안쪽을 향하도록 보관. 모든 평면의 앞쪽(양의 거리)에 있는 점이 절두체 내부.
+     * @tparam T 요소 타입
+     */
+    template <typename T>
+    struct TFrustum
+    {
+        static constexpr size_t PlaneCount = static_cast<size_t>(EFrustumPlane::Count);
+
+        TPlane<T> Planes[PlaneCount];
+
+        //////////////////////////////////////////////////////////////
+        // 생성자
+        //////////////////////////////////////////////////////////////
+
+        constexpr TFrustum() = default;
+
+        /**
+         * @brief 뷰-투영 행렬에서 절두체 평면 추출 (Gribb-Hartmann)
+         * @details Row-vector(v × M) 기준이므로 clip = (x, y, z, 1) × M 의 각 성분은 M 의 열과의 내적.
+         *          NDC X, Y: [-1, 1], Z: [0, 1] (PerspectiveProjection / OrthographicProjection2D 규약)
+         * @li Left: w + x >= 0, Right: w - x >= 0
+         * @li Bottom: w + y >= 0, Top: w - y >= 0
+         * @li Near: z >= 0, Far: w - z >= 0
+         * @param viewProjection 뷰-투영 행렬 (월드 공간 절두체가 필요하면 View * Projection)
+         */
+        explicit TFrustum(const TMatrix4x4<T>& viewProjection)
+        {
+            const TMatrix4x4<T>& m = viewProjection;
+
+            Planes[Index(EFrustumPlane::Left)]   = TPlane<T>(m._14 + m._11, m._24 + m._21, m._34 + m._31, m._44 + m._41);
+            Planes[Index(EFrustumPlane::Right)]  = TPlane<T>(m._14 - m._11, m._24 - m._21, m._34 - m._31, m._44 - m._41);
+            Planes[Index(EFrustumPlane::Bottom)] = TPlane<T>(m._14 + m._12, m._24 + m._22, m._34 + m._32, m._44 + m._42);
+            Planes[Index(EFrustumPlane::Top)]    = TPlane<T>(m._14 - m._12, m._24 - m._22, m._34 - m._32, m._44 - m._42);
+            Planes[Index(EFrustumPlane::Near)]   = TPlane<T>(m._13, m._23, m._33, m._43);
+            Planes[Index(EFrustumPlane::Far)]    = TPlane<T>(m._14 - m._13, m._24 - m._23, m._34 - m._33, m._44 - m._43);
+
+            // 구 반지름과 비교할 수 있도록 거리를 월드 단위로 맞춤
+            for (TPlane<T>& plane : Planes)
+            {
+                plane.Normalize();
+            }
+        }
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 평면 반환
+         * @param plane 평면 인덱스
+         * @return const TPlane<T>& 평면
+         */
+        constexpr const TPlane<T>& GetPlane(EFrustumPlane plane) const
+        {
+            return Planes[Index(plane)];
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 충돌 관련 (단일)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 점이 절두체 내부에 있는지 확인
+         * @param point 검사할 점
+         */
+        constexpr bool Contains(const TVector3<T>& point) const
+        {
+            for (const TPlane<T>& plane : Planes)
+            {
+                if (plane.SignedDistance(point) < T(0))
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief 구가 절두체와 겹치는지 확인
+         * @note 보수적 판정: 모서리 근처의 일부 구는 실제로 밖에 있어도 보이는 것으로 판정될 수 있음
+         * @param sphere 검사할 구
+         */
+        constexpr bool Intersects(const TBoundingSphere<T>& sphere) const
+        {
+            for (const TPlane<T>& plane : Planes)
+            {
+                if (plane.SignedDistance(sphere.Center) + sphere.Radius < T(0))
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief 상자가 절두체와 겹치는지 확인 (중심/반 크기 방식)
+         * @note 보수적 판정: 모서리 근처의 일부 상자는 실제로 밖에 있어도 보이는 것으로 판정될 수 있음
+         * @param box 검사할 상자
+         */
+        INLINE bool Intersects(const TAABB<T>& box) const
+        {
+            const TVector3<T> center  = box.GetCenter();
+            const TVector3<T> extents = box.GetExtents();
+
+            for (const TPlane<T>& plane : Planes)
+            {
+                const T reach = extents.X * std::abs(plane.Normal.X) + extents.Y * std::abs(plane.Normal.Y) + extents.Z * std::abs(plane.Normal.Z);
+                if (plane.SignedDistance(center) + reach < T(0))
+                    return false;
+            }
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 배열 컬링 (Batch)
+        // 많은 경계 볼륨을 SoA 배열로 받아 한 번에 검사하고 결과를 비트 마스크로 기록.
+        // float 은 SIMD 커널(AVX: 8개, SSE: 4개 단위로 6개 평면 검사)을 사용하고 그 외 타입은 스칼라 루프로 처리.
+        // NOTE: outVisibleMask 는 (count + 7) / 8 바이트 이상이어야 하며, i 번째 결과는 IsVisible(outVisibleMask, i) 로 확인
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 구 배열 컬링
+         * @param centerX 중심 X 배열
+         * @param centerY 중심 Y 배열
+         * @param centerZ 중심 Z 배열
+         * @param radius 반지름 배열
+         * @param count 구 개수
+         * @param outVisibleMask 가시성 비트 마스크 (보이면 1)
+         */
+        INLINE void CullSpheres(const T* centerX, const T* centerY, const T* centerZ, const T* radius, size_t count, uint8* outVisibleMask) const
+        {
+#if TDME_SIMD_SSE
+            if constexpr (std::is_same_v<T, float>)
+            {
+                float planes[PlaneCount][4];
+                GetPlaneData(planes);
+                SIMD::CullSpheres(planes, centerX, centerY, centerZ, radius, count, outVisibleMask);
+                return;
+            }
+#endif
+            std::memset(outVisibleMask, 0, (count + 7) / 8);
+            for (size_t i = 0; i < count; i++)
+            {
+                if (Intersects(TBoundingSphere<T>(TVector3<T>(centerX[i], centerY[i], centerZ[i]), radius[i])))
+                {
+                    outVisibleMask[i >> 3] |= uint8(1u << (i & 7));
+                }
+            }
+        }
+
+        /**
+         * @brief 축 정렬 상자 배열 컬링 (중심/반 크기)
+         * @param centerX 중심 X 배열
+         * @param centerY 중심 Y 배열
+         * @param centerZ 중심 Z 배열
+         * @param extentX 반 크기 X 배열
+         * @param extentY 반 크기 Y 배열
+         * @param extentZ 반 크기 Z 배열
+         * @param count 상자 개수
+         * @param outVisibleMask 가시성 비트 마스크 (보이면 1)
+         */
+        INLINE void CullBoxes(const T* centerX, const T* centerY, const T* centerZ, const T* extentX, const T* extentY, const T* extentZ,
+                              size_t count, uint8* outVisibleMask) const
+        {
+#if TDME_SIMD_SSE
+            if constexpr (std::is_same_v<T, float>)
+            {
+                float planes[PlaneCount][4];
+                GetPlaneData(planes);
+                SIMD::CullBoxes(planes, centerX, centerY, centerZ, extentX, extentY, extentZ, count, outVisibleMask);
+                return;
+            }
+#endif
+            std::memset(outVisibleMask, 0, (count + 7) / 8);
+            for (size_t i = 0; i < count; i++)
+            {
+                const TVector3<T> center(centerX[i], centerY[i], centerZ[i]);
+                const TVector3<T> extents(extentX[i], extentY[i], extentZ[i]);
+                if (Intersects(TAABB<T>::FromCenterExtents(center, extents)))
+                {
+                    outVisibleMask[i >> 3] |= uint8(1u << (i & 7));
+                }
+            }
+        }
+
+        /**
+         * @brief 배열 컬링 결과에서 index 번째 볼륨이 보이는지 확인
+         * @param visibleMask CullSpheres / CullBoxes 의 출력 마스크
+         * @param index 볼륨 인덱스
+         */
+        static constexpr bool IsVisible(const uint8* visibleMask, size_t index)
+        {
+            return (visibleMask[index >> 3] >> (index & 7)) & 1u;
+        }
+
+    private:
+        static constexpr size_t Index(EFrustumPlane plane)
+        {
+            return static_cast<size_t>(plane);
+        }
+
+        /**
+         * @brief SIMD 커널용 평면 배열 { Nx, Ny, Nz, D } 로 복사
+         */
+        INLINE void GetPlaneData(float (&outPlanes)[PlaneCount][4]) const
+        {
+            for (size_t p = 0; p < PlaneCount; p++)
+            {
+                outPlanes[p][0] = Planes[p].Normal.X;
+                outPlanes[p][1] = Planes[p].Normal.Y;
+                outPlanes[p][2] = Planes[p].Normal.Z;
+                outPlanes[p][3] = Planes[p].D;
+            }
+        }
+    };
+
+    //////////////////////////////////////////////////////////////
+    // 타입 별칭
+    //////////////////////////////////////////////////////////////
+
+    using FrustumF = TFrustum<float>;  // float 절두체
+    using FrustumD = TFrustum<double>; // double 절두체
+    using Frustum  = FrustumF;         // 기본 타입은 float
+
+} // namespace TDME
\ No newline at end of file
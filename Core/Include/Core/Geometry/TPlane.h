@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/Math/TVector3.h>
+
+#include <cmath>
+
+namespace TDME
+{
+    /**
+     * @brief 3차원 평면 클래스
+     * @details Dot(Normal, p) + D = 0 을 만족하는 점 p 의 집합. 법선 방향이 양(+)의 공간.
+     * @tparam T 요소 타입
+     */
+    template <typename T>
+    struct TPlane
+    {
+        TVector3<T> Normal;
+        T           D;
+
+        //////////////////////////////////////////////////////////////
+        // 생성자
+        //////////////////////////////////////////////////////////////
+
+        constexpr TPlane() : Normal(T(0), T(1), T(0)), D(T(0)) {}
+
+        constexpr TPlane(const TVector3<T>& normal, T d) : Normal(normal), D(d) {}
+
+        constexpr TPlane(T a, T b, T c, T d) : Normal(a, b, c), D(d) {}
+
+        /**
+         * @brief 법선과 평면 위의 한 점으로 평면 생성
+         * @param normal 평면 법선
+         * @param point 평면 위의 점
+         */
+        static constexpr TPlane FromNormalAndPoint(const TVector3<T>& normal, const TVector3<T>& point)
+        {
+            return TPlane(normal, -normal.Dot(point));
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 연산
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 점까지의 부호 있는 거리
+         * @details 법선이 정규화되어 있지 않으면 법선 길이가 곱해진 값
+         * @param point 검사할 점
+         * @return T 양수면 법선 방향(앞쪽), 음수면 뒤쪽
+         */
+        constexpr T SignedDistance(const TVector3<T>& point) const
+        {
+            return Normal.X * point.X + Normal.Y * point.Y + Normal.Z * point.Z + D;
+        }
+
+        /**
+         * @brief 법선 길이가 1이 되도록 정규화
+         * @details 법선 길이가 0이면 그대로 둠
+         */
+        INLINE void Normalize()
+        {
+            T length = Normal.Length();
+            if (length > T(0))
+            {
+                T invLength = T(1) / length;
+                Normal *= invLength;
+                D *= invLength;
+            }
+        }
+
+        /**
+         * @brief 정규화된 평면 복사본을 반환
+         * @return TPlane 정규화된 평면
+         */
+        [[nodiscard]] INLINE TPlane Normalized() const
+        {
+            TPlane result = *this;
+            result.Normalize();
+            return result;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 연산자 오버로딩
+        //////////////////////////////////////////////////////////////
+
+        constexpr bool operator==(const TPlane& other) const
+        {
+            return Normal == other.Normal && D == other.D;
+        }
+
+        constexpr bool operator!=(const TPlane& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////
+    // 타입 별칭
+    //////////////////////////////////////////////////////////////
+
+    using PlaneF = TPlane<float>;  // float 평면
+    using PlaneD = TPlane<double>; // double 평면
+    using Plane  = PlaneF;         // 기본 타입은 float
+
+} // namespace TDME
\ No newline at end of file
@@ -1,8 +1,13 @@
 #pragma once
 
 #include "Core/CoreMacros.h"
+#include "Core/CoreTypes.h"
+#include "Core/Math/SIMD/TrigSIMD.h"
 #include "MathConstants.h"
 
+#include <cmath>
+#include <type_traits>
+
 namespace TDME
 {
     namespace Math
@@ -121,5 +126,229 @@ namespace TDME
         {
             return (a > b) ? a : b;
         }
+
+        //////////////////////////////////////////////////////////////
+        // 근사 삼각함수 (다항식)
+        // libm 호출 없이 범위 축소 + 다항식으로 계산. 정점 생성, 매 프레임 회전 계산처럼 정밀도보다 처리량이 중요한 곳에서 사용.
+        // 최대 오차 (std 함수 대비, 측정값):
+        // - FastSinCos: |angle| <= 8192 에서 절대 오차 1e-7 이하 (그 이상은 범위 축소 오차가 커짐)
+        // - FastAtan2 : 절대 오차 3e-7 라디안 이하 (x = y = 0 이면 0 반환)
+        // 배열 / 8개 버전은 같은 계수의 SIMD 커널(TrigSIMD.h)을 사용하므로 스칼라 버전과 오차 범위가 같음 (사분면 경계의 반올림 방향만 다를 수 있음)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief sin / cos 동시 근사
+         * @param angle 각도 (라디안)
+         * @param outSin sin(angle)
+         * @param outCos cos(angle)
+         */
+        FORCE_INLINE constexpr void FastSinCos(float angle, float& outSin, float& outCos)
+        {
+            using namespace FastTrig;
+
+            const int32 quadrant = static_cast<int32>(angle * TwoOverPi + (angle >= 0.0f ? 0.5f : -0.5f));
+            const float q        = static_cast<float>(quadrant);
+
+            const float r  = ((angle - q * PiHalfPart1) - q * PiHalfPart2) - q * PiHalfPart3;
+            const float r2 = r * r;
+
+            const float sinPoly = r + r2 * r * (SinCoeff1 + r2 * (SinCoeff2 + r2 * SinCoeff3));
+            const float cosPoly = (1.0f - 0.5f * r2) + r2 * r2 * (CosCoeff1 + r2 * (CosCoeff2 + r2 * CosCoeff3));
+
+            // 사분면이 홀수면 sin/cos 교환, sin 은 사분면 2/3, cos 은 1/2 에서 음수 (분기 대신 선택 연산이 되도록 작성)
+            const bool  swap   = (quadrant & 1) != 0;
+            const float sinAbs = swap ? cosPoly : sinPoly;
+            const float cosAbs = swap ? sinPoly : cosPoly;
+
+            outSin = (quadrant & 2) ? -sinAbs : sinAbs;
+            outCos = ((quadrant + 1) & 2) ? -cosAbs : cosAbs;
+        }
+
+        /**
+         * @brief sin 근사
+         * @param angle 각도 (라디안)
+         * @return FORCE_INLINE constexpr float sin(angle)
+         */
+        FORCE_INLINE constexpr float FastSin(float angle)
+        {
+            float s = 0.0f, c = 0.0f;
+            FastSinCos(angle, s, c);
+            return s;
+        }
+
+        /**
+         * @brief cos 근사
+         * @param angle 각도 (라디안)
+         * @return FORCE_INLINE constexpr float cos(angle)
+         */
+        FORCE_INLINE constexpr float FastCos(float angle)
+        {
+            float s = 0.0f, c = 0.0f;
+            FastSinCos(angle, s, c);
+            return c;
+        }
+
+        /**
+         * @brief atan2 근사
+         * @details a = min(|x|, |y|) / max(|x|, |y|) 의 atan 을 다항식으로 구한 뒤 사분면을 복원
+         * @param y Y 성분
+         * @param x X 성분
+         * @return FORCE_INLINE constexpr float 각도 (라디안, [-π, π])
+         */
+        FORCE_INLINE constexpr float FastAtan2(float y, float x)
+        {
+            using namespace FastTrig;
+
+            const float absX = x < 0.0f ? -x : x;
+            const float absY = y < 0.0f ? -y : y;
+            const float a    = Min(absX, absY) / Max(Max(absX, absY), MinPositive);
+
+            const bool  reduce  = a > TanPiOver8;
+            const float reduced = reduce ? (a - 1.0f) / (a + 1.0f) : a;
+            const float z       = reduced * reduced;
+
+            float result = (reduce ? PiQuarter : 0.0f) + (reduced + z * reduced * (AtanCoeff1 + z * (AtanCoeff2 + z * (AtanCoeff3 + z * AtanCoeff4))));
+            if (absY > absX)
+                result = PiHalf - result;
+            if (x < 0.0f)
+                result = Pi - result;
+            return y < 0.0f ? -result : result;
+        }
+
+        /**
+         * @brief 배열 sin / cos 근사 (SIMD 커널, AVX: 8개 / SSE: 4개 단위)
+         * @param angles 각도 배열 (라디안)
+         * @param outSin sin 결과 배열
+         * @param outCos cos 결과 배열
+         * @param count 요소 개수
+         */
+        INLINE void FastSinCos(const float* angles, float* outSin, float* outCos, size_t count)
+        {
+#if TDME_SIMD_SSE
+            SIMD::SinCos(angles, outSin, outCos, count);
+#else
+            for (size_t i = 0; i < count; i++)
+            {
+                FastSinCos(angles[i], outSin[i], outCos[i]);
+            }
+#endif
+        }
+
+        /**
+         * @brief 배열 atan2 근사 (SIMD 커널, AVX: 8개 / SSE: 4개 단위)
+         * @param y Y 성분 배열
+         * @param x X 성분 배열
+         * @param out 결과 배열 (라디안)
+         * @param count 요소 개수
+         */
+        INLINE void FastAtan2(const float* y, const float* x, float* out, size_t count)
+        {
+#if TDME_SIMD_SSE
+            SIMD::Atan2(y, x, out, count);
+#else
+            for (size_t i = 0; i < count; i++)
+            {
+                out[i] = FastAtan2(y[i], x[i]);
+            }
+#endif
+        }
+
+        /**
+         * @brief 8개 각도의 sin / cos 근사 (AVX: 커널 1회, SSE: 2회)
+         */
+        FORCE_INLINE void FastSinCos8(const float angles[8], float outSin[8], float outCos[8])
+        {
+            FastSinCos(angles, outSin, outCos, 8);
+        }
+
+        /**
+         * @brief 8개 좌표의 atan2 근사 (AVX: 커널 1회, SSE: 2회)
+         */
+        FORCE_INLINE void FastAtan2x8(const float y[8], const float x[8], float out[8])
+        {
+            FastAtan2(y, x, out, 8);
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 삼각함수 선택 (TDME_FAST_TRIG)
+        // 엔진 코드는 이 함수들을 통해 삼각함수를 호출. TDME_FAST_TRIG = 1 이면 float 은 근사 함수, 그 외에는 std 함수 사용
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief sin / cos 동시 계산
+         * @tparam T 자료형 타입
+         * @param angle 각도 (라디안)
+         * @param outSin sin(angle)
+         * @param outCos cos(angle)
+         */
+        template <typename T>
+        FORCE_INLINE void SinCos(T angle, T& outSin, T& outCos)
+        {
+#if TDME_FAST_TRIG
+            if constexpr (std::is_same_v<T, float>)
+            {
+                FastSinCos(angle, outSin, outCos);
+                return;
+            }
+#endif
+            outSin = std::sin(angle);
+            outCos = std::cos(angle);
+        }
+
+        /**
+         * @brief 배열 sin / cos 계산 (메시 생성기의 각도 테이블용)
+         * @param angles 각도 배열 (라디안)
+         * @param outSin sin 결과 배열
+         * @param outCos cos 결과 배열
+         * @param count 요소 개수
+         */
+        INLINE void SinCos(const float* angles, float* outSin, float* outCos, size_t count)
+        {
+#if TDME_FAST_TRIG
+            FastSinCos(angles, outSin, outCos, count);
+#else
+            for (size_t i = 0; i < count; i++)
+            {
+                outSin[i] = std::sin(angles[i]);
+                outCos[i] = std::cos(angles[i]);
+            }
+#endif
+        }
+
+        /**
+         * @brief [0, range] 를 segments 등분한 각도들의 sin / cos 테이블 생성 (원, 구 메시 생성용)
+         * @details i 번째 값은 range * i / segments 의 sin / cos (i = 0 ~ segments, 총 segments + 1 개).
+         *          격자 정점마다 삼각함수를 호출하지 않고 행/열 테이블을 곱해서 사용하기 위함
+         * @param range 각도 범위 (라디안)
+         * @param segments 분할 수
+         * @param outSin sin 테이블 (segments + 1 개 이상)
+         * @param outCos cos 테이블 (segments + 1 개 이상)
+         */
+        INLINE void SinCosTable(float range, uint32 segments, float* outSin, float* outCos)
+        {
+            // 각도를 outCos 에 먼저 채운 뒤 제자리(In-place)에서 변환 (SinCos 는 요소별로 읽은 뒤 저장하므로 안전)
+            for (uint32 i = 0; i <= segments; i++)
+            {
+                outCos[i] = range * static_cast<float>(i) / static_cast<float>(segments);
+            }
+            SinCos(outCos, outSin, outCos, size_t(segments) + 1);
+        }
+
+        /**
+         * @brief atan2 계산
+         * @tparam T 자료형 타입
+         * @param y Y 성분
+         * @param x X 성분
+         * @return FORCE_INLINE T 각도 (라디안, [-π, π])
+         */
+        template <typename T>
+        FORCE_INLINE T Atan2(T y, T x)
+        {
+#if TDME_FAST_TRIG
+            if constexpr (std::is_same_v<T, float>)
+                return FastAtan2(y, x);
+#endif
+            return std::atan2(y, x);
+        }
     } // namespace Math
 } // namespace TDME
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/Math/TMatrix4x4.h"
+#include "Core/Math/TQuaternion.h"
+#include "Core/Math/SIMD/QuaternionSIMD.h"
+
+#include <type_traits>
+
+namespace TDME
+{
+    /**
+     * @brief 쿼터니언 배열 (SoA) 뷰
+     * @details X, Y, Z, W 성분을 각각의 연속 배열로 보관하는 쿼터니언 배열을 가리킴. 메모리를 소유하지 않음.
+     *          애니메이션 포즈, 다수 오브젝트의 회전 갱신처럼 많은 쿼터니언을 한 번에 처리할 때 사용.
+     * @tparam T 쿼터니언 요소 타입
+     */
+    template <typename T>
+    struct TQuaternionSoA
+    {
+        T* X;
+        T* Y;
+        T* Z;
+        T* W;
+
+        constexpr TQuaternionSoA(T* x, T* y, T* z, T* w) : X(x), Y(y), Z(z), W(w) {}
+
+        /**
+         * @brief index 번째 쿼터니언을 반환
+         */
+        constexpr TQuaternion<T> Get(size_t index) const
+        {
+            return TQuaternion<T>(X[index], Y[index], Z[index], W[index]);
+        }
+
+        /**
+         * @brief index 번째 쿼터니언을 설정
+         */
+        constexpr void Set(size_t index, const TQuaternion<T>& q) const
+        {
+            X[index] = q.X;
+            Y[index] = q.Y;
+            Z[index] = q.Z;
+            W[index] = q.W;
+        }
+    };
+
+    using QuaternionSoA = TQuaternionSoA<float>;
+
+    //////////////////////////////////////////////////////////////
+    // 쿼터니언 배열 연산 (Batch)
+    // float 은 SIMD 커널(AVX: 8개, SSE: 4개 단위)을 사용하고 그 외 타입은 TQuaternion 스칼라 루프로 처리.
+    // NOTE: 입력과 출력이 같은 배열(In-place)이어도 안전
+    //////////////////////////////////////////////////////////////
+
+    namespace QuaternionBatch
+    {
+        /**
+         * @brief AoS 쿼터니언 배열을 SoA 로 분리
+         * @tparam T 쿼터니언 요소 타입
+         * @param quaternions 입력 쿼터니언 배열
+         * @param count 쿼터니언 개수
+         * @param out 출력 SoA 배열
+         */
+        template <typename T>
+        INLINE void Scatter(const TQuaternion<T>* quaternions, size_t count, const TQuaternionSoA<T>& out)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                out.Set(i, quaternions[i]);
+            }
+        }
+
+        /**
+         * @brief SoA 쿼터니언 배열을 AoS 로 결합
+         * @tparam T 쿼터니언 요소 타입
+         * @param in 입력 SoA 배열
+         * @param count 쿼터니언 개수
+         * @param outQuaternions 출력 쿼터니언 배열
+         */
+        template <typename T>
+        INLINE void Gather(const TQuaternionSoA<T>& in, size_t count, TQuaternion<T>* outQuaternions)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                outQuaternions[i] = in.Get(i);
+            }
+        }
+
+        /**
+         * @brief 쿼터니언 배열 정규화
+         * @details float 은 rsqrt 추정값 + Newton-Raphson 1회로 계산하여 TQuaternion::Normalize 대비 상대 오차 약 1e-6 이하.
+         *          길이가 Math::SmallNumber 이하인 쿼터니언은 그대로 둠.
+         * @tparam T 쿼터니언 요소 타입
+         * @param in 입력 배열
+         * @param out 출력 배열
+         * @param count 쿼터니언 개수
+         */
+        template <typename T>
+        INLINE void Normalize(const TQuaternionSoA<T>& in, const TQuaternionSoA<T>& out, size_t count)
+        {
+#if TDME_SIMD_SSE
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const float* const src[4] = { in.X, in.Y, in.Z, in.W };
+                float* const       dst[4] = { out.X, out.Y, out.Z, out.W };
+                SIMD::QuaternionNormalize(src, dst, count);
+                return;
+            }
+#endif
+            for (size_t i = 0; i < count; i++)
+            {
+                out.Set(i, in.Get(i).Normalized());
+            }
+        }
+
+        /**
+         * @brief 쿼터니언 배열 곱셈 (out[i] = a[i] * b[i], b[i] 를 먼저 적용)
+         * @details TQuaternion::operator* 와 연산 순서가 같아 FMA 축약이 없는 한 결과가 비트 단위로 동일
+         * @tparam T 쿼터니언 요소 타입
+         * @param a 왼쪽 피연산자 배열
+         * @param b 오른쪽 피연산자 배열
+         * @param out 출력 배열
+         * @param count 쿼터니언 개수
+         */
+        template <typename T>
+        INLINE void Multiply(const TQuaternionSoA<T>& a, const TQuaternionSoA<T>& b, const TQuaternionSoA<T>& out, size_t count)
+        {
+#if TDME_SIMD_SSE
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const float* const lhs[4] = { a.X, a.Y, a.Z, a.W };
+                const float* const rhs[4] = { b.X, b.Y, b.Z, b.W };
+                float* const       dst[4] = { out.X, out.Y, out.Z, out.W };
+                SIMD::QuaternionMultiply(lhs, rhs, dst, count);
+                return;
+            }
+#endif
+            for (size_t i = 0; i < count; i++)
+            {
+                out.Set(i, a.Get(i) * b.Get(i));
+            }
+        }
+
+        /**
+         * @brief 쿼터니언 배열 구면 선형 보간 (공통 보간 계수)
+         * @details float 은 acos/sin 없이 다항식 근사로 계산하여 TQuaternion::Slerp 대비 성분 오차 약 1e-6 이하 (단위 쿼터니언 기준).
+         *          dot 이 1 에 가까운 구간도 별도 분기 없이 같은 식으로 처리.
+         * @tparam T 쿼터니언 요소 타입
+         * @param a 시작 쿼터니언 배열
+         * @param b 끝 쿼터니언 배열
+         * @param t 보간 계수 (0.0 ~ 1.0)
+         * @param out 출력 배열
+         * @param count 쿼터니언 개수
+         */
+        template <typename T>
+        INLINE void Slerp(const TQuaternionSoA<T>& a, const TQuaternionSoA<T>& b, T t, const TQuaternionSoA<T>& out, size_t count)
+        {
+#if TDME_SIMD_SSE
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const float* const from[4] = { a.X, a.Y, a.Z, a.W };
+                const float* const to[4]   = { b.X, b.Y, b.Z, b.W };
+                float* const       dst[4]  = { out.X, out.Y, out.Z, out.W };
+                SIMD::QuaternionSlerp(from, to, nullptr, t, dst, count);
+                return;
+            }
+#endif
+            for (size_t i = 0; i < count; i++)
+            {
+                out.Set(i, TQuaternion<T>::Slerp(a.Get(i), b.Get(i), t));
+            }
+        }
+
+        /**
+         * @brief 쿼터니언 배열 구면 선형 보간 (요소별 보간 계수)
+         * @tparam T 쿼터니언 요소 타입
+         * @param a 시작 쿼터니언 배열
+         * @param b 끝 쿼터니언 배열
+         * @param t 요소별 보간 계수 배열 (0.0 ~ 1.0)
+         * @param out 출력 배열
+         * @param count 쿼터니언 개수
+         */
+        template <typename T>
+        INLINE void Slerp(const TQuaternionSoA<T>& a, const TQuaternionSoA<T>& b, const T* t, const TQuaternionSoA<T>& out, size_t count)
+        {
+#if TDME_SIMD_SSE
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const float* const from[4] = { a.X, a.Y, a.Z, a.W };
+                const float* const to[4]   = { b.X, b.Y, b.Z, b.W };
+                float* const       dst[4]  = { out.X, out.Y, out.Z, out.W };
+                SIMD::QuaternionSlerp(from, to, t, 0.0f, dst, count);
+                return;
+            }
+#endif
+            for (size_t i = 0; i < count; i++)
+            {
+                out.Set(i, TQuaternion<T>::Slerp(a.Get(i), b.Get(i), t[i]));
+            }
+        }
+
+        /**
+         * @brief 쿼터니언 배열을 회전 행렬 배열로 변환
+         * @details TQuaternion::ToMatrix 와 연산 순서가 같아 FMA 축약이 없는 한 결과가 비트 단위로 동일
+         * @tparam T 쿼터니언 요소 타입
+         * @param in 입력 배열
+         * @param outMatrices 출력 행렬 배열
+         * @param count 쿼터니언 개수
+         */
+        template <typename T>
+        INLINE void ToMatrix(const TQuaternionSoA<T>& in, TMatrix4x4<T>* outMatrices, size_t count)
+        {
+#if TDME_SIMD_SSE
+            if constexpr (std::is_same_v<T, float>)
+            {
+                static_assert(sizeof(TMatrix4x4<float>) == sizeof(float) * 16, "TMatrix4x4<float> must be tightly packed");
+                const float* const src[4] = { in.X, in.Y, in.Z, in.W };
+                SIMD::QuaternionToMatrix(src, reinterpret_cast<float*>(outMatrices), count);
+                return;
+            }
+#endif
+            for (size_t i = 0; i < count; i++)
+            {
+                outMatrices[i] = TQuaternion<T>::ToMatrix(in.Get(i));
+            }
+        }
+    } // namespace QuaternionBatch
+
+} // namespace TDME
\ No newline at end of file
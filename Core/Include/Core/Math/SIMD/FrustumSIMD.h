@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/CoreTypes.h"
+#include "Core/Math/SIMD/SIMDCommon.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace TDME
+{
+    /**
+     * @brief 절두체 컬링용 SIMD 커널
+     * @details TFrustum 의 배열 컬링 함수(CullSpheres, CullBoxes)에서 사용하는 저수준 함수 모음.
+     * @li 평면은 float[6][4] = { Nx, Ny, Nz, D } (법선이 절두체 안쪽을 향함)
+     * @li 경계 볼륨은 SoA 배열로 전달, VFloatWidth(AVX: 8, SSE: 4) 개씩 6개 평면을 모두 검사
+     * @li 결과는 비트 마스크: outVisibleMask[i / 8] 의 (i % 8) 번째 비트 = i 번째 볼륨이 보이는지 여부
+     */
+    namespace SIMD
+    {
+#if TDME_SIMD_SSE
+
+        /**
+         * @brief 한 블록의 가시성 비트를 마스크 배열에 기록
+         * @details AVX 는 블록 하나가 정확히 1바이트, SSE 는 블록 두 개가 1바이트를 나누어 씀
+         */
+        FORCE_INLINE void WriteVisibleBits(uint8* outVisibleMask, size_t index, VFloat culled, uint32 laneBits)
+        {
+            const uint32 visible = ~VMoveMask(culled) & laneBits;
+            outVisibleMask[index >> 3] |= uint8(visible << (index & 7));
+        }
+
+        /**
+         * @brief 구 배열 컬링 커널
+         * @details 한 평면이라도 (부호 있는 거리 + 반지름) < 0 이면 컬링
+         */
+        INLINE void CullSpheres(const float (&planes)[6][4], const float* centerX, const float* centerY, const float* centerZ, const float* radius,
+                                size_t count, uint8* outVisibleMask)
+        {
+            std::memset(outVisibleMask, 0, (count + 7) / 8);
+
+            const VFloat zero     = VSet(0.0f);
+            const uint32 fullBits = (1u << VFloatWidth) - 1;
+
+            // 평면 성분을 루프 밖에서 미리 브로드캐스트
+            VFloat nx[6], ny[6], nz[6], d[6];
+            for (size_t p = 0; p < 6; p++)
+            {
+                nx[p] = VSet(planes[p][0]);
+                ny[p] = VSet(planes[p][1]);
+                nz[p] = VSet(planes[p][2]);
+                d[p]  = VSet(planes[p][3]);
+            }
+
+            auto cullBlock = [&](VFloat x, VFloat y, VFloat z, VFloat r) {
+                VFloat culled = zero;
+                for (size_t p = 0; p < 6; p++)
+                {
+                    const VFloat distance = VAdd(VAdd(VAdd(VMul(x, nx[p]), VMul(y, ny[p])), VMul(z, nz[p])), d[p]);
+                    culled                = VOr(culled, VLess(VAdd(distance, r), zero));
+                }
+                return culled;
+            };
+
+            size_t i = 0;
+            for (const size_t end = count & ~(VFloatWidth - 1); i < end; i += VFloatWidth)
+            {
+                WriteVisibleBits(outVisibleMask, i, cullBlock(VLoad(centerX + i), VLoad(centerY + i), VLoad(centerZ + i), VLoad(radius + i)), fullBits);
+            }
+            if (i < count)
+            {
+                const size_t rest = count - i;
+                WriteVisibleBits(outVisibleMask, i,
+                                 cullBlock(VLoadPartial(centerX + i, rest), VLoadPartial(centerY + i, rest), VLoadPartial(centerZ + i, rest), VLoadPartial(radius + i, rest)),
+                                 (1u << rest) - 1);
+            }
+        }
+
+        /**
+         * @brief 축 정렬 상자 배열 컬링 커널 (중심/반 크기)
+         * @details 평면 법선 방향으로 투영한 상자 반경 |Nx| * Ex + |Ny| * Ey + |Nz| * Ez 를 구의 반지름처럼 사용
+         */
+        INLINE void CullBoxes(const float (&planes)[6][4], const float* centerX, const float* centerY, const float* centerZ,
+                              const float* extentX, const float* extentY, const float* extentZ, size_t count, uint8* outVisibleMask)
+        {
+            std::memset(outVisibleMask, 0, (count + 7) / 8);
+
+            const VFloat zero     = VSet(0.0f);
+            const uint32 fullBits = (1u << VFloatWidth) - 1;
+
+            // 평면 성분과 법선 절댓값을 루프 밖에서 미리 브로드캐스트
+            VFloat nx[6], ny[6], nz[6], d[6], ax[6], ay[6], az[6];
+            for (size_t p = 0; p < 6; p++)
+            {
+                nx[p] = VSet(planes[p][0]);
+                ny[p] = VSet(planes[p][1]);
+                nz[p] = VSet(planes[p][2]);
+                d[p]  = VSet(planes[p][3]);
+                ax[p] = VSet(std::abs(planes[p][0]));
+                ay[p] = VSet(std::abs(planes[p][1]));
+                az[p] = VSet(std::abs(planes[p][2]));
+            }
+
+            auto cullBlock = [&](VFloat x, VFloat y, VFloat z, VFloat ex, VFloat ey, VFloat ez) {
+                VFloat culled = zero;
+                for (size_t p = 0; p < 6; p++)
+                {
+                    const VFloat distance = VAdd(VAdd(VAdd(VMul(x, nx[p]), VMul(y, ny[p])), VMul(z, nz[p])), d[p]);
+                    const VFloat reach    = VAdd(VAdd(VMul(ex, ax[p]), VMul(ey, ay[p])), VMul(ez, az[p]));
+                    culled                = VOr(culled, VLess(VAdd(distance, reach), zero));
+                }
+                return culled;
+            };
+
+            size_t i = 0;
+            for (const size_t end = count & ~(VFloatWidth - 1); i < end; i += VFloatWidth)
+            {
+                WriteVisibleBits(outVisibleMask, i,
+                                 cullBlock(VLoad(centerX + i), VLoad(centerY + i), VLoad(centerZ + i), VLoad(extentX + i), VLoad(extentY + i), VLoad(extentZ + i)),
+                                 fullBits);
+            }
+            if (i < count)
+            {
+                const size_t rest = count - i;
+                WriteVisibleBits(outVisibleMask, i,
+                                 cullBlock(VLoadPartial(centerX + i, rest), VLoadPartial(centerY + i, rest), VLoadPartial(centerZ + i, rest),
+                                           VLoadPartial(extentX + i, rest), VLoadPartial(extentY + i, rest), VLoadPartial(extentZ + i, rest)),
+                                 (1u << rest) - 1);
+            }
+        }
+
+#endif // TDME_SIMD_SSE
+    } // namespace SIMD
+} // namespace TDME
\ No newline at end of file
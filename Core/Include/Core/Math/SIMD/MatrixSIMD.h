@@ -0,0 +1,363 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/Math/MathConstants.h"
+#include "Core/Math/SIMD/SIMDCommon.h"
+
+namespace TDME
+{
+    /**
+     * @brief 4x4 / 3x4 float 행렬용 SIMD 커널
+     * @details TMatrix4x4<float>, TMatrix3x4<float> 특수화에서 사용하는 저수준 함수 모음.
+     * @note 모든 함수는 Row-major float[16] (3x4: float[12]) 배열을 입력으로 받으며, 정렬(alignment)을 요구하지 않음.
+     * @note 입력과 출력 포인터가 같은 메모리를 가리켜도 안전하도록 결과를 레지스터에 모은 뒤 저장.
+     */
+    namespace SIMD
+    {
+#if TDME_SIMD_SSE
+
+        //////////////////////////////////////////////////////////////
+        // 2x2 행렬 헬퍼 (블록 역행렬용)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 2x2 행렬 곱 (A * B)
+         * @details __m128 하나에 Row-major 2x2 행렬(a00, a01, a10, a11)을 담아 계산
+         */
+        FORCE_INLINE __m128 Mat2Mul(__m128 a, __m128 b)
+        {
+            return _mm_add_ps(_mm_mul_ps(a, TDME_SWIZZLE(b, 0, 3, 0, 3)),
+                              _mm_mul_ps(TDME_SWIZZLE(a, 1, 0, 3, 2), TDME_SWIZZLE(b, 2, 1, 2, 1)));
+        }
+
+        /**
+         * @brief 2x2 수반 행렬 곱 (adj(A) * B)
+         */
+        FORCE_INLINE __m128 Mat2AdjMul(__m128 a, __m128 b)
+        {
+            return _mm_sub_ps(_mm_mul_ps(TDME_SWIZZLE(a, 3, 3, 0, 0), b),
+                              _mm_mul_ps(TDME_SWIZZLE(a, 1, 1, 2, 2), TDME_SWIZZLE(b, 2, 3, 0, 1)));
+        }
+
+        /**
+         * @brief 2x2 수반 행렬 곱 (A * adj(B))
+         */
+        FORCE_INLINE __m128 Mat2MulAdj(__m128 a, __m128 b)
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, TDME_SWIZZLE(b, 3, 0, 3, 0)),
+                              _mm_mul_ps(TDME_SWIZZLE(a, 1, 0, 3, 2), TDME_SWIZZLE(b, 2, 1, 2, 1)));
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 4x4 행렬 커널
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 4x4 행렬 곱 (out = a * b)
+         * @details 결과의 i 번째 행 = a[i][0] * b[0] + a[i][1] * b[1] + a[i][2] * b[2] + a[i][3] * b[3]
+         * @note 스칼라 구현과 같은 순서로 더하므로 FMA 축약이 없는 한 결과가 비트 단위로 동일
+         * @param a 왼쪽 행렬
+         * @param b 오른쪽 행렬
+         * @param out 결과 행렬
+         */
+        FORCE_INLINE void MatrixMultiply(const float* a, const float* b, float* out)
+        {
+    #if TDME_SIMD_AVX
+            // 두 행을 한 번에 처리 (256비트 레지스터의 하위/상위 128비트 = a 의 연속된 두 행)
+            const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 0));
+            const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+            const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+            const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+
+            const __m256 a01 = _mm256_loadu_ps(a + 0);
+            const __m256 a23 = _mm256_loadu_ps(a + 8);
+
+            __m256 r01 = _mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0x00), b0);
+            r01        = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0x55), b1));
+            r01        = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0xAA), b2));
+            r01        = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_shuffle_ps(a01, a01, 0xFF), b3));
+
+            __m256 r23 = _mm256_mul_ps(_mm256_shuffle_ps(a23, a23, 0x00), b0);
+            r23        = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_shuffle_ps(a23, a23, 0x55), b1));
+            r23        = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_shuffle_ps(a23, a23, 0xAA), b2));
+            r23        = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_shuffle_ps(a23, a23, 0xFF), b3));
+
+            _mm256_storeu_ps(out + 0, r01);
+            _mm256_storeu_ps(out + 8, r23);
+    #else
+            const __m128 b0 = _mm_loadu_ps(b + 0);
+            const __m128 b1 = _mm_loadu_ps(b + 4);
+            const __m128 b2 = _mm_loadu_ps(b + 8);
+            const __m128 b3 = _mm_loadu_ps(b + 12);
+
+            __m128 rows[4];
+            for (int row = 0; row < 4; row++)
+            {
+                const __m128 ar = _mm_loadu_ps(a + row * 4);
+
+                __m128 r = _mm_mul_ps(TDME_SWIZZLE(ar, 0, 0, 0, 0), b0);
+                r        = _mm_add_ps(r, _mm_mul_ps(TDME_SWIZZLE(ar, 1, 1, 1, 1), b1));
+                r        = _mm_add_ps(r, _mm_mul_ps(TDME_SWIZZLE(ar, 2, 2, 2, 2), b2));
+                r        = _mm_add_ps(r, _mm_mul_ps(TDME_SWIZZLE(ar, 3, 3, 3, 3), b3));
+                rows[row] = r;
+            }
+
+            _mm_storeu_ps(out + 0, rows[0]);
+            _mm_storeu_ps(out + 4, rows[1]);
+            _mm_storeu_ps(out + 8, rows[2]);
+            _mm_storeu_ps(out + 12, rows[3]);
+    #endif
+        }
+
+        /**
+         * @brief 4x4 전치 행렬 (out = transpose(m))
+         * @param m 입력 행렬
+         * @param out 결과 행렬
+         */
+        FORCE_INLINE void MatrixTranspose(const float* m, float* out)
+        {
+            __m128 r0 = _mm_loadu_ps(m + 0);
+            __m128 r1 = _mm_loadu_ps(m + 4);
+            __m128 r2 = _mm_loadu_ps(m + 8);
+            __m128 r3 = _mm_loadu_ps(m + 12);
+
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+            _mm_storeu_ps(out + 0, r0);
+            _mm_storeu_ps(out + 4, r1);
+            _mm_storeu_ps(out + 8, r2);
+            _mm_storeu_ps(out + 12, r3);
+        }
+
+        /**
+         * @brief 4x4 일반 역행렬 (out = inverse(m))
+         * @details 2x2 블록 행렬 분해로 계산
+         * @li M = | A B |, |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+         * @li     | C D |
+         * @li 각 블록의 수반 행렬을 구한 뒤 1/|M| 으로 스케일하여 재배치
+         * @note 행렬식이 0에 가까우면(|det| < Math::SmallNumber) out 을 건드리지 않고 false 반환
+         * @param m 입력 행렬
+         * @param out 결과 행렬
+         * @return bool 역행렬 존재 여부
+         */
+        FORCE_INLINE bool MatrixInverse(const float* m, float* out)
+        {
+            const __m128 r0 = _mm_loadu_ps(m + 0);
+            const __m128 r1 = _mm_loadu_ps(m + 4);
+            const __m128 r2 = _mm_loadu_ps(m + 8);
+            const __m128 r3 = _mm_loadu_ps(m + 12);
+
+            // 2x2 부분 행렬
+            const __m128 A = _mm_movelh_ps(r0, r1);
+            const __m128 B = _mm_movehl_ps(r1, r0);
+            const __m128 C = _mm_movelh_ps(r2, r3);
+            const __m128 D = _mm_movehl_ps(r3, r2);
+
+            // 각 부분 행렬의 행렬식 (|A|, |B|, |C|, |D|)
+            const __m128 detSub = _mm_sub_ps(
+                _mm_mul_ps(TDME_SHUFFLE(r0, r2, 0, 2, 0, 2), TDME_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+                _mm_mul_ps(TDME_SHUFFLE(r0, r2, 1, 3, 1, 3), TDME_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+
+            const __m128 detA = TDME_SWIZZLE(detSub, 0, 0, 0, 0);
+            const __m128 detB = TDME_SWIZZLE(detSub, 1, 1, 1, 1);
+            const __m128 detC = TDME_SWIZZLE(detSub, 2, 2, 2, 2);
+            const __m128 detD = TDME_SWIZZLE(detSub, 3, 3, 3, 3);
+
+            const __m128 D_C = Mat2AdjMul(D, C); // adj(D) * C
+            const __m128 A_B = Mat2AdjMul(A, B); // adj(A) * B
+
+            __m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, D_C));    // |D|A - B(adj(D)C)
+            __m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, A_B));    // |A|D - C(adj(A)B)
+            __m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, A_B)); // |B|C - D adj(adj(A)B)
+            __m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, D_C)); // |C|B - A adj(adj(D)C)
+
+            // tr((adj(A)B)(adj(D)C))
+            __m128 tr = _mm_mul_ps(A_B, TDME_SWIZZLE(D_C, 0, 2, 1, 3));
+            tr        = _mm_add_ps(tr, TDME_SWIZZLE(tr, 2, 3, 0, 1));
+            tr        = _mm_add_ps(tr, TDME_SWIZZLE(tr, 1, 0, 3, 2));
+
+            __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+            detM        = _mm_sub_ps(detM, tr);
+
+            const float det = _mm_cvtss_f32(detM);
+            if (det > -Math::SmallNumber && det < Math::SmallNumber)
+            {
+                return false;
+            }
+
+            // (1/|M|, -1/|M|, -1/|M|, 1/|M|)
+            const __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+            X_ = _mm_mul_ps(X_, rDetM);
+            Y_ = _mm_mul_ps(Y_, rDetM);
+            Z_ = _mm_mul_ps(Z_, rDetM);
+            W_ = _mm_mul_ps(W_, rDetM);
+
+            // 수반 행렬 셔플과 저장 순서 재배치를 한 번에 처리
+            _mm_storeu_ps(out + 0, TDME_SHUFFLE(X_, Y_, 3, 1, 3, 1));
+            _mm_storeu_ps(out + 4, TDME_SHUFFLE(X_, Y_, 2, 0, 2, 0));
+            _mm_storeu_ps(out + 8, TDME_SHUFFLE(Z_, W_, 3, 1, 3, 1));
+            _mm_storeu_ps(out + 12, TDME_SHUFFLE(Z_, W_, 2, 0, 2, 0));
+            return true;
+        }
+
+        /**
+         * @brief 4x4 아핀 역행렬 (out = inverse(m), 마지막 열 = (0, 0, 0, 1))
+         * @details 3x3 부분 행렬의 역행렬은 행 벡터 외적으로 구함
+         * @li A^-1 = transpose(r1 x r2, r2 x r0, r0 x r1) / det, det = r0 · (r1 x r2)
+         * @li 이동 = -(t.x * A^-1[0] + t.y * A^-1[1] + t.z * A^-1[2])
+         * @note 행렬식이 0에 가까우면(|det| < Math::SmallNumber) out 을 건드리지 않고 false 반환
+         * @param m 입력 행렬
+         * @param out 결과 행렬
+         * @return bool 역행렬 존재 여부
+         */
+        FORCE_INLINE bool MatrixInverseAffine(const float* m, float* out)
+        {
+            const __m128 r0 = _mm_loadu_ps(m + 0);
+            const __m128 r1 = _mm_loadu_ps(m + 4);
+            const __m128 r2 = _mm_loadu_ps(m + 8);
+            const __m128 t  = _mm_loadu_ps(m + 12);
+
+            // 외적 a x b = (a.yzx * b.zxy) - (a.zxy * b.yzx)
+            auto cross = [](__m128 a, __m128 b)
+            {
+                return _mm_sub_ps(_mm_mul_ps(TDME_SWIZZLE(a, 1, 2, 0, 3), TDME_SWIZZLE(b, 2, 0, 1, 3)),
+                                  _mm_mul_ps(TDME_SWIZZLE(a, 2, 0, 1, 3), TDME_SWIZZLE(b, 1, 2, 0, 3)));
+            };
+
+            __m128 c0 = cross(r1, r2);
+            __m128 c1 = cross(r2, r0);
+            __m128 c2 = cross(r0, r1);
+
+            // det = r0 · (r1 x r2) (w 성분은 외적에서 0 이 되므로 4성분 합을 그대로 사용)
+            __m128 det = _mm_mul_ps(r0, c0);
+            det        = _mm_add_ps(det, TDME_SWIZZLE(det, 2, 3, 0, 1));
+            det        = _mm_add_ps(det, TDME_SWIZZLE(det, 1, 0, 3, 2));
+
+            const float detScalar = _mm_cvtss_f32(det);
+            if (detScalar > -Math::SmallNumber && detScalar < Math::SmallNumber)
+            {
+                return false;
+            }
+
+            const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+            c0                  = _mm_mul_ps(c0, invDet);
+            c1                  = _mm_mul_ps(c1, invDet);
+            c2                  = _mm_mul_ps(c2, invDet);
+
+            // 외적 결과는 역행렬의 "열" 이므로 전치하여 행으로 변환 (w 열은 0 으로 채워짐)
+            __m128 c3 = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+            __m128 tr = _mm_mul_ps(TDME_SWIZZLE(t, 0, 0, 0, 0), c0);
+            tr        = _mm_add_ps(tr, _mm_mul_ps(TDME_SWIZZLE(t, 1, 1, 1, 1), c1));
+            tr        = _mm_add_ps(tr, _mm_mul_ps(TDME_SWIZZLE(t, 2, 2, 2, 2), c2));
+            tr        = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), tr);
+
+            _mm_storeu_ps(out + 0, c0);
+            _mm_storeu_ps(out + 4, c1);
+            _mm_storeu_ps(out + 8, c2);
+            _mm_storeu_ps(out + 12, tr);
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 3x4 아핀 행렬 커널 (TMatrix3x4<float>)
+        // float[12] = 3개의 행 (각 행 = 3x3 부분 행렬의 한 행 + 이동 성분), 암묵적인 마지막 행 = (0, 0, 0, 1)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 3x4 아핀 행렬 곱 (out = b ∘ a, 열 벡터 기준으로 a 를 먼저 적용)
+         * @details 결과의 i 번째 행 = b[i][0] * a[0] + b[i][1] * a[1] + b[i][2] * a[2] + (0, 0, 0, b[i][3])
+         * @note 스칼라 구현과 같은 순서로 더하므로 FMA 축약이 없는 한 결과가 비트 단위로 동일
+         * @param a 먼저 적용할 행렬
+         * @param b 나중에 적용할 행렬
+         * @param out 결과 행렬
+         */
+        FORCE_INLINE void Matrix3x4Multiply(const float* a, const float* b, float* out)
+        {
+            const __m128 a0 = _mm_loadu_ps(a + 0);
+            const __m128 a1 = _mm_loadu_ps(a + 4);
+            const __m128 a2 = _mm_loadu_ps(a + 8);
+
+            // 이동 성분(w)만 남기는 마스크
+            const __m128 wMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+
+            __m128 rows[3];
+            for (int row = 0; row < 3; row++)
+            {
+                const __m128 br = _mm_loadu_ps(b + row * 4);
+
+                __m128 r = _mm_mul_ps(TDME_SWIZZLE(br, 0, 0, 0, 0), a0);
+                r        = _mm_add_ps(r, _mm_mul_ps(TDME_SWIZZLE(br, 1, 1, 1, 1), a1));
+                r        = _mm_add_ps(r, _mm_mul_ps(TDME_SWIZZLE(br, 2, 2, 2, 2), a2));
+                r        = _mm_add_ps(r, _mm_and_ps(br, wMask));
+                rows[row] = r;
+            }
+
+            _mm_storeu_ps(out + 0, rows[0]);
+            _mm_storeu_ps(out + 4, rows[1]);
+            _mm_storeu_ps(out + 8, rows[2]);
+        }
+
+        /**
+         * @brief 3x4 아핀 역행렬 (out = inverse(m))
+         * @details 3x3 부분 행렬 L 의 역행렬은 행 벡터 외적으로 구함
+         * @li L^-1 의 열 = (r1 x r2, r2 x r0, r0 x r1) / det, det = r0 · (r1 x r2)
+         * @li 이동 = -(L^-1 * t) = -(t.x * L^-1 열0 + t.y * L^-1 열1 + t.z * L^-1 열2)
+         * @note 행렬식이 0에 가까우면(|det| < Math::SmallNumber) out 을 건드리지 않고 false 반환
+         * @param m 입력 행렬
+         * @param out 결과 행렬
+         * @return bool 역행렬 존재 여부
+         */
+        FORCE_INLINE bool Matrix3x4Inverse(const float* m, float* out)
+        {
+            const __m128 r0 = _mm_loadu_ps(m + 0);
+            const __m128 r1 = _mm_loadu_ps(m + 4);
+            const __m128 r2 = _mm_loadu_ps(m + 8);
+
+            // 외적 a x b = (a.yzx * b.zxy) - (a.zxy * b.yzx) (w 성분은 a.w * b.w - a.w * b.w = 0)
+            auto cross = [](__m128 a, __m128 b)
+            {
+                return _mm_sub_ps(_mm_mul_ps(TDME_SWIZZLE(a, 1, 2, 0, 3), TDME_SWIZZLE(b, 2, 0, 1, 3)),
+                                  _mm_mul_ps(TDME_SWIZZLE(a, 2, 0, 1, 3), TDME_SWIZZLE(b, 1, 2, 0, 3)));
+            };
+
+            __m128 c0 = cross(r1, r2);
+            __m128 c1 = cross(r2, r0);
+            __m128 c2 = cross(r0, r1);
+
+            // det = r0 · (r1 x r2) (c0.w = 0 이므로 4성분 합을 그대로 사용)
+            __m128 det = _mm_mul_ps(r0, c0);
+            det        = _mm_add_ps(det, TDME_SWIZZLE(det, 2, 3, 0, 1));
+            det        = _mm_add_ps(det, TDME_SWIZZLE(det, 1, 0, 3, 2));
+
+            const float detScalar = _mm_cvtss_f32(det);
+            if (detScalar > -Math::SmallNumber && detScalar < Math::SmallNumber)
+            {
+                return false;
+            }
+
+            const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+            c0                  = _mm_mul_ps(c0, invDet);
+            c1                  = _mm_mul_ps(c1, invDet);
+            c2                  = _mm_mul_ps(c2, invDet);
+
+            // 이동 t = (r0.w, r1.w, r2.w)
+            __m128 tr = _mm_mul_ps(TDME_SWIZZLE(r0, 3, 3, 3, 3), c0);
+            tr        = _mm_add_ps(tr, _mm_mul_ps(TDME_SWIZZLE(r1, 3, 3, 3, 3), c1));
+            tr        = _mm_add_ps(tr, _mm_mul_ps(TDME_SWIZZLE(r2, 3, 3, 3, 3), c2));
+            tr        = _mm_sub_ps(_mm_setzero_ps(), tr);
+
+            // 열(c0, c1, c2, 이동)을 전치하여 행으로 변환 (4번째 행은 버림)
+            _MM_TRANSPOSE4_PS(c0, c1, c2, tr);
+
+            _mm_storeu_ps(out + 0, c0);
+            _mm_storeu_ps(out + 4, c1);
+            _mm_storeu_ps(out + 8, c2);
+            return true;
+        }
+
+#endif // TDME_SIMD_SSE
+    } // namespace SIMD
+} // namespace TDME
@@ -0,0 +1,304 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/Math/SIMD/SIMDCommon.h"
+
+namespace TDME
+{
+    /**
+     * @brief 쿼터니언 배열(SoA) 연산용 SIMD 커널
+     * @details QuaternionBatch.h 에서 사용하는 저수준 함수 모음.
+     * @li 쿼터니언 스트림은 float* [4] = { X, Y, Z, W } 배열로 전달
+     * @li VFloatWidth(AVX: 8, SSE: 4) 단위로 처리하고, 남은 요소는 패딩된 임시 블록으로 같은 커널을 한 번 더 실행
+     *     (배열 내 위치와 관계없이 같은 입력은 같은 결과를 냄)
+     * @note 블록 단위로 모두 읽은 뒤 저장하므로 입력과 출력이 같은 배열(In-place)이어도 안전
+     */
+    namespace SIMD
+    {
+#if TDME_SIMD_SSE
+
+        //////////////////////////////////////////////////////////////
+        // 블록 로드/저장 헬퍼
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 레인 단위 쿼터니언 (X/Y/Z/W 각각 VFloatWidth 개)
+         */
+        struct VQuaternion
+        {
+            VFloat X, Y, Z, W;
+        };
+
+        FORCE_INLINE VQuaternion LoadQuaternions(const float* const q[4], size_t index)
+        {
+            return { VLoad(q[0] + index), VLoad(q[1] + index), VLoad(q[2] + index), VLoad(q[3] + index) };
+        }
+
+        FORCE_INLINE void StoreQuaternions(float* const q[4], size_t index, const VQuaternion& v)
+        {
+            VStore(q[0] + index, v.X);
+            VStore(q[1] + index, v.Y);
+            VStore(q[2] + index, v.Z);
+            VStore(q[3] + index, v.W);
+        }
+
+        /**
+         * @brief VFloatWidth 보다 적은 개수를 로드 (빈 레인은 항등 쿼터니언으로 채움)
+         */
+        FORCE_INLINE VQuaternion LoadQuaternionsPartial(const float* const q[4], size_t index, size_t count)
+        {
+            alignas(32) float lanes[4][VFloatWidth];
+            for (size_t c = 0; c < 4; c++)
+            {
+                for (size_t i = 0; i < VFloatWidth; i++)
+                {
+                    lanes[c][i] = (i < count) ? q[c][index + i] : (c == 3 ? 1.0f : 0.0f);
+                }
+            }
+            return { VLoad(lanes[0]), VLoad(lanes[1]), VLoad(lanes[2]), VLoad(lanes[3]) };
+        }
+
+        /**
+         * @brief VFloatWidth 보다 적은 개수를 저장 (앞쪽 count 개 레인만 기록)
+         */
+        FORCE_INLINE void StoreQuaternionsPartial(float* const q[4], size_t index, size_t count, const VQuaternion& v)
+        {
+            alignas(32) float lanes[4][VFloatWidth];
+            VStore(lanes[0], v.X);
+            VStore(lanes[1], v.Y);
+            VStore(lanes[2], v.Z);
+            VStore(lanes[3], v.W);
+            for (size_t c = 0; c < 4; c++)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    q[c][index + i] = lanes[c][i];
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 레인 연산
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 정규화 (rsqrt + Newton-Raphson 1회)
+         * @details 길이가 Math::SmallNumber 이하인 쿼터니언은 TQuaternion::Normalize 와 같이 그대로 둠
+         */
+        FORCE_INLINE VQuaternion NormalizeLanes(const VQuaternion& q)
+        {
+            const VFloat lenSq  = VAdd(VAdd(VAdd(VMul(q.X, q.X), VMul(q.Y, q.Y)), VMul(q.Z, q.Z)), VMul(q.W, q.W));
+            const VFloat valid  = VGreater(lenSq, VSet(1e-16f)); // SmallNumber^2
+            const VFloat invLen = VSelect(valid, VInvSqrt(lenSq), VSet(1.0f));
+            return { VMul(q.X, invLen), VMul(q.Y, invLen), VMul(q.Z, invLen), VMul(q.W, invLen) };
+        }
+
+        /**
+         * @brief 곱셈 (a * b, b 를 먼저 적용) - TQuaternion::operator* 와 연산 순서가 같아 FMA 축약이 없는 한 결과가 비트 단위로 동일
+         */
+        FORCE_INLINE VQuaternion MultiplyLanes(const VQuaternion& a, const VQuaternion& b)
+        {
+            return {
+                VSub(VAdd(VAdd(VMul(a.W, b.X), VMul(a.X, b.W)), VMul(a.Y, b.Z)), VMul(a.Z, b.Y)), // X
+                VAdd(VAdd(VSub(VMul(a.W, b.Y), VMul(a.X, b.Z)), VMul(a.Y, b.W)), VMul(a.Z, b.X)), // Y
+                VAdd(VSub(VAdd(VMul(a.W, b.Z), VMul(a.X, b.Y)), VMul(a.Y, b.X)), VMul(a.Z, b.W)), // Z
+                VSub(VSub(VSub(VMul(a.W, b.W), VMul(a.X, b.X)), VMul(a.Y, b.Y)), VMul(a.Z, b.Z))  // W
+            };
+        }
+
+        /**
+         * @brief 구면 선형 보간 (최단 경로)
+         * @details acos/sin 없이 곱셈/덧셈만으로 Slerp 계수를 구하는 급수 근사를 사용
+         *          (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP").
+         *          cos(theta) = x 일 때 sin(t * theta) / sin(theta) 를 x - 1 에 대한 12항 급수로 전개하고
+         *          마지막 항의 계수에 (1 + mu) 를 곱해 잘린 나머지 항을 보정. x ∈ [0, 1], t ∈ [0, 1] 에서 계수 최대 오차 약 7e-7.
+         * @note dot < 0 이면 b 의 부호를 뒤집어 x = |dot| 으로 계산 (TQuaternion::Slerp 와 같은 최단 경로)
+         */
+        FORCE_INLINE VQuaternion SlerpLanes(const VQuaternion& a, const VQuaternion& b, VFloat t)
+        {
+            constexpr int   TermCount = 12;
+            constexpr float OnePlusMu = 1.894f; // 최대 오차가 최소가 되도록 수치적으로 맞춘 값
+
+            const VFloat dot  = VAdd(VAdd(VAdd(VMul(a.X, b.X), VMul(a.Y, b.Y)), VMul(a.Z, b.Z)), VMul(a.W, b.W));
+            const VFloat sign = VAnd(dot, VSet(-0.0f));
+
+            const VFloat one  = VSet(1.0f);
+            const VFloat xm1  = VSub(VXor(dot, sign), one); // |dot| - 1
+            const VFloat d    = VSub(one, t);
+            const VFloat sqrT = VMul(t, t);
+            const VFloat sqrD = VMul(d, d);
+
+            // Horner 방식으로 안쪽 항부터 누적: c = 1 + b[i] * c
+            VFloat cT = one;
+            VFloat cD = one;
+            for (int i = TermCount; i >= 1; i--)
+            {
+                // u_i = 1 / (i * (2i + 1)), v_i = i / (2i + 1)
+                const float  scale = (i == TermCount) ? OnePlusMu : 1.0f;
+                const VFloat u     = VSet(scale / float(i * (2 * i + 1)));
+                const VFloat v     = VSet(scale * float(i) / float(2 * i + 1));
+                cT                 = VAdd(one, VMul(VMul(VSub(VMul(u, sqrT), v), xm1), cT));
+                cD                 = VAdd(one, VMul(VMul(VSub(VMul(u, sqrD), v), xm1), cD));
+            }
+            cT = VXor(VMul(t, cT), sign); // 최단 경로: b 대신 계수의 부호를 뒤집음
+            cD = VMul(d, cD);
+
+            return {
+                VAdd(VMul(a.X, cD), VMul(b.X, cT)), // X
+                VAdd(VMul(a.Y, cD), VMul(b.Y, cT)), // Y
+                VAdd(VMul(a.Z, cD), VMul(b.Z, cT)), // Z
+                VAdd(VMul(a.W, cD), VMul(b.W, cT))  // W
+            };
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 배열 커널
+        //////////////////////////////////////////////////////////////
+
+        INLINE void QuaternionNormalize(const float* const in[4], float* const out[4], size_t count)
+        {
+            size_t i = 0;
+            for (const size_t end = count & ~(VFloatWidth - 1); i < end; i += VFloatWidth)
+            {
+                StoreQuaternions(out, i, NormalizeLanes(LoadQuaternions(in, i)));
+            }
+            if (i < count)
+            {
+                StoreQuaternionsPartial(out, i, count - i, NormalizeLanes(LoadQuaternionsPartial(in, i, count - i)));
+            }
+        }
+
+        INLINE void QuaternionMultiply(const float* const a[4], const float* const b[4], float* const out[4], size_t count)
+        {
+            size_t i = 0;
+            for (const size_t end = count & ~(VFloatWidth - 1); i < end; i += VFloatWidth)
+            {
+                StoreQuaternions(out, i, MultiplyLanes(LoadQuaternions(a, i), LoadQuaternions(b, i)));
+            }
+            if (i < count)
+            {
+                const size_t rest = count - i;
+                StoreQuaternionsPartial(out, i, rest, MultiplyLanes(LoadQuaternionsPartial(a, i, rest), LoadQuaternionsPartial(b, i, rest)));
+            }
+        }
+
+        /**
+         * @brief 구면 선형 보간 배열 커널
+         * @param t 요소별 보간 계수 배열 (nullptr 이면 모든 요소에 uniformT 사용)
+         * @param uniformT t 가 nullptr 일 때 사용할 공통 보간 계수
+         */
+        INLINE void QuaternionSlerp(const float* const a[4], const float* const b[4], const float* t, float uniformT, float* const out[4], size_t count)
+        {
+            const VFloat tUniform = VSet(uniformT);
+
+            size_t i = 0;
+            for (const size_t end = count & ~(VFloatWidth - 1); i < end; i += VFloatWidth)
+            {
+                const VFloat tv = t ? VLoad(t + i) : tUniform;
+                StoreQuaternions(out, i, SlerpLanes(LoadQuaternions(a, i), LoadQuaternions(b, i), tv));
+            }
+            if (i < count)
+            {
+                const size_t rest = count - i;
+                const VFloat tv   = t ? VLoadPartial(t + i, rest) : tUniform;
+                StoreQuaternionsPartial(out, i, rest, SlerpLanes(LoadQuaternionsPartial(a, i, rest), LoadQuaternionsPartial(b, i, rest), tv));
+            }
+        }
+
+        /**
+         * @brief 회전 행렬 4개의 한 행을 저장 (r0/r1/r2 의 레인 k → outMatrices[k] 의 열 0~2, 열 3 = 0)
+         */
+        FORCE_INLINE void StoreMatrixRows(__m128 r0, __m128 r1, __m128 r2, float* outMatrices, size_t row)
+        {
+            __m128 r3 = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(outMatrices + 0 * 16 + row * 4, r0);
+            _mm_storeu_ps(outMatrices + 1 * 16 + row * 4, r1);
+            _mm_storeu_ps(outMatrices + 2 * 16 + row * 4, r2);
+            _mm_storeu_ps(outMatrices + 3 * 16 + row * 4, r3);
+        }
+
+        /**
+         * @brief 회전 행렬 VFloatWidth 개 저장 (4개씩 나누어 전치 후 저장, 4번째 행은 (0, 0, 0, 1))
+         */
+        FORCE_INLINE void StoreRotationMatrices(const VFloat (&m)[9], float* outMatrices)
+        {
+            const __m128 lastRow = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+            for (size_t group = 0; group < VFloatWidth / 4; group++)
+            {
+                __m128 e[9];
+                for (size_t k = 0; k < 9; k++)
+                {
+    #if TDME_SIMD_AVX
+                    e[k] = group == 0 ? _mm256_castps256_ps128(m[k]) : _mm256_extractf128_ps(m[k], 1);
+    #else
+                    e[k] = m[k];
+    #endif
+                }
+
+                float* dst = outMatrices + group * 4 * 16;
+                StoreMatrixRows(e[0], e[1], e[2], dst, 0);
+                StoreMatrixRows(e[3], e[4], e[5], dst, 1);
+                StoreMatrixRows(e[6], e[7], e[8], dst, 2);
+                for (size_t k = 0; k < 4; k++)
+                {
+                    _mm_storeu_ps(dst + k * 16 + 12, lastRow);
+                }
+            }
+        }
+
+        /**
+         * @brief 회전 행렬 계산 - TQuaternion::ToMatrix 와 연산 순서가 같아 FMA 축약이 없는 한 결과가 비트 단위로 동일
+         */
+        FORCE_INLINE void RotationMatrixLanes(const VQuaternion& q, VFloat (&m)[9])
+        {
+            const VFloat one = VSet(1.0f);
+            const VFloat two = VSet(2.0f);
+
+            const VFloat xx = VMul(q.X, q.X), yy = VMul(q.Y, q.Y), zz = VMul(q.Z, q.Z);
+            const VFloat xy = VMul(q.X, q.Y), xz = VMul(q.X, q.Z), yz = VMul(q.Y, q.Z);
+            const VFloat wx = VMul(q.W, q.X), wy = VMul(q.W, q.Y), wz = VMul(q.W, q.Z);
+
+            m[0] = VSub(one, VMul(two, VAdd(yy, zz)));
+            m[1] = VMul(two, VAdd(xy, wz));
+            m[2] = VMul(two, VSub(xz, wy));
+            m[3] = VMul(two, VSub(xy, wz));
+            m[4] = VSub(one, VMul(two, VAdd(xx, zz)));
+            m[5] = VMul(two, VAdd(yz, wx));
+            m[6] = VMul(two, VAdd(xz, wy));
+            m[7] = VMul(two, VSub(yz, wx));
+            m[8] = VSub(one, VMul(two, VAdd(xx, yy)));
+        }
+
+        /**
+         * @brief 회전 행렬 배열 커널
+         * @param outMatrices Row-major float[16] 행렬 배열
+         */
+        INLINE void QuaternionToMatrix(const float* const in[4], float* outMatrices, size_t count)
+        {
+            VFloat m[9];
+
+            size_t i = 0;
+            for (const size_t end = count & ~(VFloatWidth - 1); i < end; i += VFloatWidth)
+            {
+                RotationMatrixLanes(LoadQuaternions(in, i), m);
+                StoreRotationMatrices(m, outMatrices + i * 16);
+            }
+            if (i < count)
+            {
+                const size_t rest = count - i;
+                float        block[VFloatWidth * 16];
+
+                RotationMatrixLanes(LoadQuaternionsPartial(in, i, rest), m);
+                StoreRotationMatrices(m, block);
+                for (size_t k = 0; k < rest * 16; k++)
+                {
+                    outMatrices[i * 16 + k] = block[k];
+                }
+            }
+        }
+
+#endif // TDME_SIMD_SSE
+    } // namespace SIMD
+} // namespace TDME
\ No newline at end of file
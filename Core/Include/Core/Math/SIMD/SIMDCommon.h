@@ -0,0 +1,161 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/CoreTypes.h"
+
+#if TDME_SIMD_SSE || TDME_SIMD_AVX
+    #include <immintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////
+// SIMD 공용 헬퍼
+// SIMD 커널 헤더(MatrixSIMD.h, TransformSIMD.h 등)에서 공통으로 사용하는 셔플 매크로와 레인 연산.
+//////////////////////////////////////////////////////////////
+
+#if TDME_SIMD_SSE
+
+    /**
+     * @brief _mm_shuffle_ps / _mm256_shuffle_ps 용 셔플 마스크 생성 (_MM_SHUFFLE 과 인자 순서가 반대)
+     * @details 결과 레인 0~3 에 들어갈 원본 레인 인덱스를 순서대로 지정
+     */
+    #define TDME_SHUFFLE_MASK(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+    /**
+     * @brief 한 벡터의 레인 재배치 (결과 = vec[x], vec[y], vec[z], vec[w])
+     */
+    #define TDME_SWIZZLE(vec, x, y, z, w) _mm_shuffle_ps(vec, vec, TDME_SHUFFLE_MASK(x, y, z, w))
+
+    /**
+     * @brief 두 벡터의 레인 조합 (결과 = vec1[x], vec1[y], vec2[z], vec2[w])
+     */
+    #define TDME_SHUFFLE(vec1, vec2, x, y, z, w) _mm_shuffle_ps(vec1, vec2, TDME_SHUFFLE_MASK(x, y, z, w))
+
+#endif // TDME_SIMD_SSE
+
+#if TDME_SIMD_AVX
+
+    /**
+     * @brief 256비트 버전 TDME_SHUFFLE (128비트 레인 단위로 각각 적용)
+     */
+    #define TDME_SHUFFLE256(vec1, vec2, x, y, z, w) _mm256_shuffle_ps(vec1, vec2, TDME_SHUFFLE_MASK(x, y, z, w))
+
+#endif // TDME_SIMD_AVX
+
+
+//////////////////////////////////////////////////////////////
+// 레인 연산 헬퍼 (VFloat)
+// SoA 배열을 처리하는 커널에서 AVX(8개)/SSE(4개) 폭을 구분하지 않고 한 번만 작성하기 위한 얇은 래퍼.
+// 빌드 옵션에서 사용 가능한 가장 넓은 레지스터를 VFloat 로 사용.
+//////////////////////////////////////////////////////////////
+
+#if TDME_SIMD_SSE
+
+namespace TDME
+{
+    namespace SIMD
+    {
+    #if TDME_SIMD_AVX
+        using VFloat = __m256;
+        INLINE constexpr size_t VFloatWidth = 8;
+
+        FORCE_INLINE VFloat VLoad(const float* src) { return _mm256_loadu_ps(src); }
+        FORCE_INLINE void VStore(float* dst, VFloat v) { _mm256_storeu_ps(dst, v); }
+        FORCE_INLINE VFloat VSet(float value) { return _mm256_set1_ps(value); }
+        FORCE_INLINE VFloat VAdd(VFloat a, VFloat b) { return _mm256_add_ps(a, b); }
+        FORCE_INLINE VFloat VSub(VFloat a, VFloat b) { return _mm256_sub_ps(a, b); }
+        FORCE_INLINE VFloat VMul(VFloat a, VFloat b) { return _mm256_mul_ps(a, b); }
+        FORCE_INLINE VFloat VDiv(VFloat a, VFloat b) { return _mm256_div_ps(a, b); }
+        FORCE_INLINE VFloat VMin(VFloat a, VFloat b) { return _mm256_min_ps(a, b); }
+        FORCE_INLINE VFloat VMax(VFloat a, VFloat b) { return _mm256_max_ps(a, b); }
+        FORCE_INLINE VFloat VAnd(VFloat a, VFloat b) { return _mm256_and_ps(a, b); }
+        FORCE_INLINE VFloat VOr(VFloat a, VFloat b) { return _mm256_or_ps(a, b); }
+        FORCE_INLINE VFloat VXor(VFloat a, VFloat b) { return _mm256_xor_ps(a, b); }
+        FORCE_INLINE VFloat VRsqrtEstimate(VFloat v) { return _mm256_rsqrt_ps(v); }
+        FORCE_INLINE VFloat VGreater(VFloat a, VFloat b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        FORCE_INLINE VFloat VLess(VFloat a, VFloat b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+
+        /**
+         * @brief 마스크 레인의 부호 비트를 모아 정수로 반환 (레인 i → 비트 i)
+         */
+        FORCE_INLINE uint32 VMoveMask(VFloat mask) { return uint32(_mm256_movemask_ps(mask)); }
+
+        /**
+         * @brief 마스크 레인이 참이면 a, 거짓이면 b 를 선택
+         */
+        FORCE_INLINE VFloat VSelect(VFloat mask, VFloat a, VFloat b) { return _mm256_blendv_ps(b, a, mask); }
+    #else
+        using VFloat = __m128;
+        INLINE constexpr size_t VFloatWidth = 4;
+
+        FORCE_INLINE VFloat VLoad(const float* src) { return _mm_loadu_ps(src); }
+        FORCE_INLINE void VStore(float* dst, VFloat v) { _mm_storeu_ps(dst, v); }
+        FORCE_INLINE VFloat VSet(float value) { return _mm_set1_ps(value); }
+        FORCE_INLINE VFloat VAdd(VFloat a, VFloat b) { return _mm_add_ps(a, b); }
+        FORCE_INLINE VFloat VSub(VFloat a, VFloat b) { return _mm_sub_ps(a, b); }
+        FORCE_INLINE VFloat VMul(VFloat a, VFloat b) { return _mm_mul_ps(a, b); }
+        FORCE_INLINE VFloat VDiv(VFloat a, VFloat b) { return _mm_div_ps(a, b); }
+        FORCE_INLINE VFloat VMin(VFloat a, VFloat b) { return _mm_min_ps(a, b); }
+        FORCE_INLINE VFloat VMax(VFloat a, VFloat b) { return _mm_max_ps(a, b); }
+        FORCE_INLINE VFloat VAnd(VFloat a, VFloat b) { return _mm_and_ps(a, b); }
+        FORCE_INLINE VFloat VOr(VFloat a, VFloat b) { return _mm_or_ps(a, b); }
+        FORCE_INLINE VFloat VXor(VFloat a, VFloat b) { return _mm_xor_ps(a, b); }
+        FORCE_INLINE VFloat VRsqrtEstimate(VFloat v) { return _mm_rsqrt_ps(v); }
+        FORCE_INLINE VFloat VGreater(VFloat a, VFloat b) { return _mm_cmpgt_ps(a, b); }
+        FORCE_INLINE VFloat VLess(VFloat a, VFloat b) { return _mm_cmplt_ps(a, b); }
+
+        /**
+         * @brief 마스크 레인의 부호 비트를 모아 정수로 반환 (레인 i → 비트 i)
+         */
+        FORCE_INLINE uint32 VMoveMask(VFloat mask) { return uint32(_mm_movemask_ps(mask)); }
+
+        /**
+         * @brief 마스크 레인이 참이면 a, 거짓이면 b 를 선택 (SSE4.1 blendv 없이 비트 연산으로 처리)
+         */
+        FORCE_INLINE VFloat VSelect(VFloat mask, VFloat a, VFloat b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    #endif
+
+        /**
+         * @brief 1 / sqrt(v) 근사 (rsqrt 추정값 + Newton-Raphson 1회)
+         * @details rsqrt 추정값(상대 오차 약 1.5 * 2^-12)을 y' = y * (1.5 - 0.5 * v * y * y) 로 한 번 보정하여
+         *          상대 오차를 약 1e-6 수준으로 줄임
+         * @note v = 0 이면 결과가 NaN 이 되므로 호출부에서 마스크로 걸러야 함
+         */
+        FORCE_INLINE VFloat VInvSqrt(VFloat v)
+        {
+            const VFloat y   = VRsqrtEstimate(v);
+            const VFloat hvy = VMul(VMul(VSet(0.5f), v), y);
+            return VMul(y, VSub(VSet(1.5f), VMul(hvy, y)));
+        }
+
+        /**
+         * @brief 절댓값 (부호 비트 제거)
+         */
+        FORCE_INLINE VFloat VAbs(VFloat v) { return VXor(v, VAnd(v, VSet(-0.0f))); }
+
+        /**
+         * @brief 가장 가까운 정수로 반올림 (반올림 모드: 짝수 쪽)
+         * @details 1.5 * 2^23 을 더했다 빼서 소수부를 버림 (SSE4.1 round 없이 동작)
+         * @note |v| < 2^22 범위에서만 정확
+         */
+        FORCE_INLINE VFloat VRound(VFloat v)
+        {
+            const VFloat magic = VSet(12582912.0f);
+            return VSub(VAdd(v, magic), magic);
+        }
+
+        /**
+         * @brief 앞쪽 count 개(< VFloatWidth)만 읽고 나머지 레인은 0 으로 채워 로드 (배열 끝 처리용)
+         */
+        FORCE_INLINE VFloat VLoadPartial(const float* src, size_t count)
+        {
+            alignas(32) float lanes[VFloatWidth] = {};
+            for (size_t i = 0; i < count; i++)
+            {
+                lanes[i] = src[i];
+            }
+            return VLoad(lanes);
+        }
+    } // namespace SIMD
+} // namespace TDME
+
+#endif // TDME_SIMD_SSE
\ No newline at end of file
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/CoreTypes.h"
+#include "Core/Math/SIMD/SIMDCommon.h"
+
+namespace TDME
+{
+    /**
+     * @brief 점/방향 벡터 배열 변환용 SIMD 커널
+     * @details Transformations.h 의 배열 변환 함수(TransformPositions 등)에서 사용하는 저수준 함수 모음.
+     * @li 행렬은 Row-major float[16] (Row-vector(v × M) 기준), 4번째 열은 무시 (아핀 행렬 가정)
+     * @li translationScale = 1 이면 점(이동 포함), 0 이면 방향 벡터(이동 제외)
+     * @note 블록 단위로 모두 읽은 뒤 저장하므로 입력과 출력이 같은 배열(In-place)이어도 안전
+     */
+    namespace SIMD
+    {
+#if TDME_SIMD_SSE
+
+        //////////////////////////////////////////////////////////////
+        // AoS ↔ SoA 재배치 헬퍼
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 연속된 4개의 XYZ 를 X/Y/Z 벡터로 분리
+         * @details a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3 → x0..x3, y0..y3, z0..z3
+         * @note 256비트 버전도 128비트 레인별로 같은 셔플을 사용
+         */
+        FORCE_INLINE void DeinterleaveXYZ(__m128 a, __m128 b, __m128 c, __m128& x, __m128& y, __m128& z)
+        {
+            x = TDME_SHUFFLE(a, TDME_SHUFFLE(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+            y = TDME_SHUFFLE(TDME_SHUFFLE(a, b, 1, 1, 0, 0), TDME_SHUFFLE(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+            z = TDME_SHUFFLE(TDME_SHUFFLE(a, b, 2, 2, 1, 1), TDME_SHUFFLE(c, c, 0, 0, 3, 3), 0, 2, 0, 2);
+        }
+
+        /**
+         * @brief X/Y/Z 벡터를 연속된 4개의 XYZ 로 결합 (DeinterleaveXYZ 의 역연산)
+         */
+        FORCE_INLINE void InterleaveXYZ(__m128 x, __m128 y, __m128 z, __m128& a, __m128& b, __m128& c)
+        {
+            a = TDME_SHUFFLE(TDME_SHUFFLE(x, y, 0, 1, 0, 1), TDME_SHUFFLE(z, x, 0, 0, 1, 1), 0, 2, 0, 2);
+            b = TDME_SHUFFLE(TDME_SHUFFLE(y, z, 1, 1, 1, 1), TDME_SHUFFLE(x, y, 2, 2, 2, 2), 0, 2, 0, 2);
+            c = TDME_SHUFFLE(TDME_SHUFFLE(z, x, 2, 2, 3, 3), TDME_SHUFFLE(y, z, 3, 3, 3, 3), 0, 2, 0, 2);
+        }
+
+    #if TDME_SIMD_AVX
+        FORCE_INLINE void DeinterleaveXYZ(__m256 a, __m256 b, __m256 c, __m256& x, __m256& y, __m256& z)
+        {
+            x = TDME_SHUFFLE256(a, TDME_SHUFFLE256(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+            y = TDME_SHUFFLE256(TDME_SHUFFLE256(a, b, 1, 1, 0, 0), TDME_SHUFFLE256(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+            z = TDME_SHUFFLE256(TDME_SHUFFLE256(a, b, 2, 2, 1, 1), TDME_SHUFFLE256(c, c, 0, 0, 3, 3), 0, 2, 0, 2);
+        }
+
+        FORCE_INLINE void InterleaveXYZ(__m256 x, __m256 y, __m256 z, __m256& a, __m256& b, __m256& c)
+        {
+            a = TDME_SHUFFLE256(TDME_SHUFFLE256(x, y, 0, 1, 0, 1), TDME_SHUFFLE256(z, x, 0, 0, 1, 1), 0, 2, 0, 2);
+            b = TDME_SHUFFLE256(TDME_SHUFFLE256(y, z, 1, 1, 1, 1), TDME_SHUFFLE256(x, y, 2, 2, 2, 2), 0, 2, 0, 2);
+            c = TDME_SHUFFLE256(TDME_SHUFFLE256(z, x, 2, 2, 3, 3), TDME_SHUFFLE256(y, z, 3, 3, 3, 3), 0, 2, 0, 2);
+        }
+    #endif
+
+        //////////////////////////////////////////////////////////////
+        // 단일 행렬 × N 개
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief SoA 배열 변환 (X/Y/Z 가 각각 분리된 배열)
+         * @details AVX 빌드에서는 8개, SSE 빌드에서는 4개씩 처리하고 나머지는 스칼라로 처리
+         * @param inX 입력 X 배열
+         * @param inY 입력 Y 배열
+         * @param inZ 입력 Z 배열
+         * @param outX 출력 X 배열
+         * @param outY 출력 Y 배열
+         * @param outZ 출력 Z 배열
+         * @param count 개수
+         * @param m 변환 행렬 (float[16])
+         * @param translationScale 이동 성분 가중치 (점 = 1, 방향 = 0)
+         */
+        INLINE void TransformSoA(const float* inX, const float* inY, const float* inZ,
+                                 float* outX, float* outY, float* outZ,
+                                 size_t count, const float* m, float translationScale)
+        {
+            const float tx = m[12] * translationScale;
+            const float ty = m[13] * translationScale;
+            const float tz = m[14] * translationScale;
+
+            size_t i = 0;
+
+    #if TDME_SIMD_AVX
+            {
+                const __m256 m11 = _mm256_set1_ps(m[0]), m12 = _mm256_set1_ps(m[1]), m13 = _mm256_set1_ps(m[2]);
+                const __m256 m21 = _mm256_set1_ps(m[4]), m22 = _mm256_set1_ps(m[5]), m23 = _mm256_set1_ps(m[6]);
+                const __m256 m31 = _mm256_set1_ps(m[8]), m32 = _mm256_set1_ps(m[9]), m33 = _mm256_set1_ps(m[10]);
+                const __m256 m41 = _mm256_set1_ps(tx), m42 = _mm256_set1_ps(ty), m43 = _mm256_set1_ps(tz);
+
+                for (const size_t end = count & ~size_t(7); i < end; i += 8)
+                {
+                    const __m256 x = _mm256_loadu_ps(inX + i);
+                    const __m256 y = _mm256_loadu_ps(inY + i);
+                    const __m256 z = _mm256_loadu_ps(inZ + i);
+
+                    const __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m11), _mm256_mul_ps(y, m21)), _mm256_mul_ps(z, m31)), m41);
+                    const __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m12), _mm256_mul_ps(y, m22)), _mm256_mul_ps(z, m32)), m42);
+                    const __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m13), _mm256_mul_ps(y, m23)), _mm256_mul_ps(z, m33)), m43);
+
+                    _mm256_storeu_ps(outX + i, rx);
+                    _mm256_storeu_ps(outY + i, ry);
+                    _mm256_storeu_ps(outZ + i, rz);
+                }
+            }
+    #endif
+            {
+                const __m128 m11 = _mm_set1_ps(m[0]), m12 = _mm_set1_ps(m[1]), m13 = _mm_set1_ps(m[2]);
+                const __m128 m21 = _mm_set1_ps(m[4]), m22 = _mm_set1_ps(m[5]), m23 = _mm_set1_ps(m[6]);
+                const __m128 m31 = _mm_set1_ps(m[8]), m32 = _mm_set1_ps(m[9]), m33 = _mm_set1_ps(m[10]);
+                const __m128 m41 = _mm_set1_ps(tx), m42 = _mm_set1_ps(ty), m43 = _mm_set1_ps(tz);
+
+                for (const size_t end = count & ~size_t(3); i < end; i += 4)
+                {
+                    const __m128 x = _mm_loadu_ps(inX + i);
+                    const __m128 y = _mm_loadu_ps(inY + i);
+                    const __m128 z = _mm_loadu_ps(inZ + i);
+
+                    const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m11), _mm_mul_ps(y, m21)), _mm_mul_ps(z, m31)), m41);
+                    const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m12), _mm_mul_ps(y, m22)), _mm_mul_ps(z, m32)), m42);
+                    const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m13), _mm_mul_ps(y, m23)), _mm_mul_ps(z, m33)), m43);
+
+                    _mm_storeu_ps(outX + i, rx);
+                    _mm_storeu_ps(outY + i, ry);
+                    _mm_storeu_ps(outZ + i, rz);
+                }
+            }
+
+            // 나머지 (스칼라)
+            for (; i < count; i++)
+            {
+                const float x = inX[i], y = inY[i], z = inZ[i];
+                outX[i]       = x * m[0] + y * m[4] + z * m[8] + tx;
+                outY[i]       = x * m[1] + y * m[5] + z * m[9] + ty;
+                outZ[i]       = x * m[2] + y * m[6] + z * m[10] + tz;
+            }
+        }
+
+        /**
+         * @brief AoS 배열 변환 (XYZ 가 연속된 float[3] 배열)
+         * @details 4개(AVX: 8개) 단위로 SoA 로 재배치하여 계산한 뒤 다시 AoS 로 저장
+         * @param in 입력 배열 (float[3] * count)
+         * @param out 출력 배열 (float[3] * count)
+         * @param count 개수
+         * @param m 변환 행렬 (float[16])
+         * @param translationScale 이동 성분 가중치 (점 = 1, 방향 = 0)
+         */
+        INLINE void TransformAoS(const float* in, float* out, size_t count, const float* m, float translationScale)
+        {
+            const float tx = m[12] * translationScale;
+            const float ty = m[13] * translationScale;
+            const float tz = m[14] * translationScale;
+
+            size_t i = 0;
+
+    #if TDME_SIMD_AVX
+            {
+                const __m256 m11 = _mm256_set1_ps(m[0]), m12 = _mm256_set1_ps(m[1]), m13 = _mm256_set1_ps(m[2]);
+                const __m256 m21 = _mm256_set1_ps(m[4]), m22 = _mm256_set1_ps(m[5]), m23 = _mm256_set1_ps(m[6]);
+                const __m256 m31 = _mm256_set1_ps(m[8]), m32 = _mm256_set1_ps(m[9]), m33 = _mm256_set1_ps(m[10]);
+                const __m256 m41 = _mm256_set1_ps(tx), m42 = _mm256_set1_ps(ty), m43 = _mm256_set1_ps(tz);
+
+                for (const size_t end = count & ~size_t(7); i < end; i += 8)
+                {
+                    // 하위 128비트 = 0~3번, 상위 128비트 = 4~7번
+                    const float* p = in + i * 3;
+                    const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 12), 1);
+                    const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+                    const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+
+                    __m256 x, y, z;
+                    DeinterleaveXYZ(a, b, c, x, y, z);
+
+                    const __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m11), _mm256_mul_ps(y, m21)), _mm256_mul_ps(z, m31)), m41);
+                    const __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m12), _mm256_mul_ps(y, m22)), _mm256_mul_ps(z, m32)), m42);
+                    const __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m13), _mm256_mul_ps(y, m23)), _mm256_mul_ps(z, m33)), m43);
+
+                    __m256 ra, rb, rc;
+                    InterleaveXYZ(rx, ry, rz, ra, rb, rc);
+
+                    float* q = out + i * 3;
+                    _mm_storeu_ps(q + 0, _mm256_castps256_ps128(ra));
+                    _mm_storeu_ps(q + 4, _mm256_castps256_ps128(rb));
+                    _mm_storeu_ps(q + 8, _mm256_castps256_ps128(rc));
+                    _mm_storeu_ps(q + 12, _mm256_extractf128_ps(ra, 1));
+                    _mm_storeu_ps(q + 16, _mm256_extractf128_ps(rb, 1));
+                    _mm_storeu_ps(q + 20, _mm256_extractf128_ps(rc, 1));
+                }
+            }
+    #endif
+            {
+                const __m128 m11 = _mm_set1_ps(m[0]), m12 = _mm_set1_ps(m[1]), m13 = _mm_set1_ps(m[2]);
+                const __m128 m21 = _mm_set1_ps(m[4]), m22 = _mm_set1_ps(m[5]), m23 = _mm_set1_ps(m[6]);
+                const __m128 m31 = _mm_set1_ps(m[8]), m32 = _mm_set1_ps(m[9]), m33 = _mm_set1_ps(m[10]);
+                const __m128 m41 = _mm_set1_ps(tx), m42 = _mm_set1_ps(ty), m43 = _mm_set1_ps(tz);
+
+                for (const size_t end = count & ~size_t(3); i < end; i += 4)
+                {
+                    const float* p = in + i * 3;
+
+                    __m128 x, y, z;
+                    DeinterleaveXYZ(_mm_loadu_ps(p + 0), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+
+                    const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m11), _mm_mul_ps(y, m21)), _mm_mul_ps(z, m31)), m41);
+                    const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m12), _mm_mul_ps(y, m22)), _mm_mul_ps(z, m32)), m42);
+                    const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m13), _mm_mul_ps(y, m23)), _mm_mul_ps(z, m33)), m43);
+
+                    __m128 ra, rb, rc;
+                    InterleaveXYZ(rx, ry, rz, ra, rb, rc);
+
+                    float* q = out + i * 3;
+                    _mm_storeu_ps(q + 0, ra);
+                    _mm_storeu_ps(q + 4, rb);
+                    _mm_storeu_ps(q + 8, rc);
+                }
+            }
+
+            // 나머지 (스칼라)
+            for (; i < count; i++)
+            {
+                const float x = in[i * 3 + 0], y = in[i * 3 + 1], z = in[i * 3 + 2];
+                out[i * 3 + 0] = x * m[0] + y * m[4] + z * m[8] + tx;
+                out[i * 3 + 1] = x * m[1] + y * m[5] + z * m[9] + ty;
+                out[i * 3 + 2] = x * m[2] + y * m[6] + z * m[10] + tz;
+            }
+        }
+
+        //////////////////////////////////////////////////////////////
+        // N 개 행렬 × N 개
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 각 점을 대응되는 행렬로 변환 (out[i] = in[i] * matrices[i])
+         * @details 행렬마다 4개 행을 읽어 한 점씩 처리 (행렬 전치 비용이 없도록 AoS 유지)
+         * @param in 입력 배열 (float[3] * count)
+         * @param matrices 행렬 배열 (float[16] * count)
+         * @param out 출력 배열 (float[3] * count)
+         * @param count 개수
+         * @param translationScale 이동 성분 가중치 (점 = 1, 방향 = 0)
+         */
+        INLINE void TransformAoSPerMatrix(const float* in, const float* matrices, float* out, size_t count, float translationScale)
+        {
+            const __m128 ts = _mm_set1_ps(translationScale);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                const float* m = matrices + i * 16;
+
+                const __m128 x = _mm_set1_ps(in[i * 3 + 0]);
+                const __m128 y = _mm_set1_ps(in[i * 3 + 1]);
+                const __m128 z = _mm_set1_ps(in[i * 3 + 2]);
+
+                __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_loadu_ps(m + 0)), _mm_mul_ps(y, _mm_loadu_ps(m + 4))), _mm_mul_ps(z, _mm_loadu_ps(m + 8)));
+                r        = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 12), ts));
+
+                // XYZ 만 저장 (다음 원소를 덮어쓰지 않도록 8바이트 + 4바이트로 분할)
+                float* q = out + i * 3;
+                _mm_storel_pi(reinterpret_cast<__m64*>(q), r);
+                _mm_store_ss(q + 2, _mm_movehl_ps(r, r));
+            }
+        }
+
+#endif // TDME_SIMD_SSE
+    } // namespace SIMD
+} // namespace TDME
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Core/CoreMacros.h"
+#include "Core/Math/SIMD/SIMDCommon.h"
+
+namespace TDME
+{
+    //////////////////////////////////////////////////////////////
+    // 근사 삼각함수 계수
+    // Math::FastSinCos / FastAtan2 (스칼라)와 SIMD 커널이 같은 계수를 사용하여 경로와 관계없이 같은 정밀도를 가짐
+    //////////////////////////////////////////////////////////////
+
+    namespace Math
+    {
+        namespace FastTrig
+        {
+            // π/2 를 세 부분으로 나눈 값 (Cody-Waite 범위 축소: x - q * π/2 를 정밀도 손실 없이 계산)
+            INLINE constexpr float PiHalfPart1 = 1.5703125f;
+            INLINE constexpr float PiHalfPart2 = 4.837512969970703125e-4f;
+            INLINE constexpr float PiHalfPart3 = 7.54978995489188216e-8f;
+            INLINE constexpr float TwoOverPi   = 0.636619772367581343f;
+
+            // sin(r) ≈ r + r^3 * (S1 + r^2 * (S2 + r^2 * S3)),  r ∈ [-π/4, π/4]
+            INLINE constexpr float SinCoeff1 = -1.6666654611e-1f;
+            INLINE constexpr float SinCoeff2 = 8.3321608736e-3f;
+            INLINE constexpr float SinCoeff3 = -1.9515295891e-4f;
+
+            // cos(r) ≈ 1 - r^2 / 2 + r^4 * (C1 + r^2 * (C2 + r^2 * C3)),  r ∈ [-π/4, π/4]
+            INLINE constexpr float CosCoeff1 = 4.166664568298827e-2f;
+            INLINE constexpr float CosCoeff2 = -1.388731625493765e-3f;
+            INLINE constexpr float CosCoeff3 = 2.443315711809948e-5f;
+
+            // atan(a) ≈ a + a^3 * (A1 + a^2 * (A2 + a^2 * (A3 + a^2 * A4))),  a ∈ [-tan(π/8), tan(π/8)]
+            INLINE constexpr float TanPiOver8 = 0.4142135623730950f;
+            INLINE constexpr float AtanCoeff1 = -3.33329491539e-1f;
+            INLINE constexpr float AtanCoeff2 = 1.99777106478e-1f;
+            INLINE constexpr float AtanCoeff3 = -1.38776856032e-1f;
+            INLINE constexpr float AtanCoeff4 = 8.05374449538e-2f;
+
+            INLINE constexpr float MinPositive = 1.17549435e-38f; // 0 으로 나누기 방지용 (FLT_MIN)
+        } // namespace FastTrig
+    } // namespace Math
+
+    /**
+     * @brief 근사 삼각함수 배열 연산용 SIMD 커널
+     * @details MathUtils.h 의 FastSinCos / FastAtan2 배열 버전에서 사용하는 저수준 함수 모음.
+     * @li VFloatWidth(AVX: 8, SSE: 4) 단위로 처리하고, 남은 요소는 패딩된 임시 블록으로 같은 커널을 한 번 더 실행
+     * @li 사분면 판별까지 모두 float 연산으로 처리하여 AVX(정수 256비트 연산 없음)에서도 같은 코드로 동작
+     */
+    namespace SIMD
+    {
+#if TDME_SIMD_SSE
+
+        /**
+         * @brief 레인별 sin / cos 동시 계산
+         * @details q = round(x * 2/π), r = x - q * π/2 로 축소한 뒤 다항식으로 sin(r), cos(r) 을 구하고
+         *          q mod 4 에 따라 sin/cos 교환과 부호를 결정
+         */
+        FORCE_INLINE void SinCosLanes(VFloat x, VFloat& outSin, VFloat& outCos)
+        {
+            using namespace Math::FastTrig;
+
+            const VFloat q = VRound(VMul(x, VSet(TwoOverPi)));
+
+            VFloat r = VSub(x, VMul(q, VSet(PiHalfPart1)));
+            r        = VSub(r, VMul(q, VSet(PiHalfPart2)));
+            r        = VSub(r, VMul(q, VSet(PiHalfPart3)));
+
+            const VFloat r2 = VMul(r, r);
+
+            VFloat sinPoly = VAdd(VSet(SinCoeff2), VMul(r2, VSet(SinCoeff3)));
+            sinPoly        = VAdd(VSet(SinCoeff1), VMul(r2, sinPoly));
+            sinPoly        = VAdd(r, VMul(VMul(r2, r), sinPoly));
+
+            VFloat cosPoly = VAdd(VSet(CosCoeff2), VMul(r2, VSet(CosCoeff3)));
+            cosPoly        = VAdd(VSet(CosCoeff1), VMul(r2, cosPoly));
+            cosPoly        = VAdd(VSub(VSet(1.0f), VMul(VSet(0.5f), r2)), VMul(VMul(r2, r2), cosPoly));
+
+            // 사분면 m = q mod 4 (음수 q 도 0~3), q 가 홀수이면 sin/cos 교환
+            const VFloat m   = VSub(q, VMul(VSet(4.0f), VRound(VSub(VMul(q, VSet(0.25f)), VSet(0.375f)))));
+            const VFloat odd = VGreater(VSub(q, VMul(VSet(2.0f), VRound(VSub(VMul(q, VSet(0.5f)), VSet(0.25f))))), VSet(0.5f));
+
+            const VFloat signBit = VSet(-0.0f);
+            const VFloat sinNeg  = VAnd(VGreater(m, VSet(1.5f)), signBit);                    // m = 2, 3
+            const VFloat cosNeg  = VAnd(VLess(VAbs(VSub(m, VSet(1.5f))), VSet(1.0f)), signBit); // m = 1, 2
+
+            outSin = VXor(VSelect(odd, cosPoly, sinPoly), sinNeg);
+            outCos = VXor(VSelect(odd, sinPoly, cosPoly), cosNeg);
+        }
+
+        /**
+         * @brief 레인별 atan2(y, x)
+         * @details a = min(|x|, |y|) / max(|x|, |y|) ∈ [0, 1] 의 atan 을 구한 뒤 사분면을 복원.
+         *          a > tan(π/8) 이면 atan(a) = π/4 + atan((a - 1) / (a + 1)) 로 다항식 구간을 줄임
+         */
+        FORCE_INLINE VFloat Atan2Lanes(VFloat y, VFloat x)
+        {
+            using namespace Math::FastTrig;
+
+            const VFloat absX = VAbs(x);
+            const VFloat absY = VAbs(y);
+            const VFloat a    = VDiv(VMin(absX, absY), VMax(VMax(absX, absY), VSet(MinPositive)));
+
+            const VFloat reduce  = VGreater(a, VSet(TanPiOver8));
+            const VFloat reduced = VSelect(reduce, VDiv(VSub(a, VSet(1.0f)), VAdd(a, VSet(1.0f))), a);
+            const VFloat offset  = VAnd(reduce, VSet(0.785398163397448310f));
+
+            const VFloat z = VMul(reduced, reduced);
+
+            VFloat poly = VAdd(VSet(AtanCoeff3), VMul(z, VSet(AtanCoeff4)));
+            poly        = VAdd(VSet(AtanCoeff2), VMul(z, poly));
+            poly        = VAdd(VSet(AtanCoeff1), VMul(z, poly));
+
+            VFloat result = VAdd(offset, VAdd(reduced, VMul(VMul(z, reduced), poly)));
+            result        = VSelect(VGreater(absY, absX), VSub(VSet(1.57079632679489662f), result), result);
+            result        = VSelect(VLess(x, VSet(0.0f)), VSub(VSet(3.14159265358979324f), result), result);
+            return VXor(result, VAnd(VLess(y, VSet(0.0f)), VSet(-0.0f)));
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 배열 커널
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief angles[i] 의 sin / cos 을 outSin[i], outCos[i] 에 저장
+         */
+        INLINE void SinCos(const float* angles, float* outSin, float* outCos, size_t count)
+        {
+            size_t i = 0;
+            for (; i + VFloatWidth <= count; i += VFloatWidth)
+            {
+                VFloat s, c;
+                SinCosLanes(VLoad(angles + i), s, c);
+                VStore(outSin + i, s);
+                VStore(outCos + i, c);
+            }
+
+            if (i < count)
+            {
+                const size_t rest = count - i;
+
+                alignas(32) float sinLanes[VFloatWidth];
+                alignas(32) float cosLanes[VFloatWidth];
+
+                VFloat s, c;
+                SinCosLanes(VLoadPartial(angles + i, rest), s, c);
+                VStore(sinLanes, s);
+                VStore(cosLanes, c);
+                for (size_t k = 0; k < rest; k++)
+                {
+                    outSin[i + k] = sinLanes[k];
+                    outCos[i + k] = cosLanes[k];
+                }
+            }
+        }
+
+        /**
+         * @brief atan2(y[i], x[i]) 를 out[i] 에 저장
+         */
+        INLINE void Atan2(const float* y, const float* x, float* out, size_t count)
+        {
+            size_t i = 0;
+            for (; i + VFloatWidth <= count; i += VFloatWidth)
+            {
+                VStore(out + i, Atan2Lanes(VLoad(y + i), VLoad(x + i)));
+            }
+
+            if (i < count)
+            {
+                const size_t rest = count - i;
+
+                alignas(32) float lanes[VFloatWidth];
+                VStore(lanes, Atan2Lanes(VLoadPartial(y + i, rest), VLoadPartial(x + i, rest)));
+                for (size_t k = 0; k < rest; k++)
+                {
+                    out[i + k] = lanes[k];
+                }
+            }
+        }
+
+#endif // TDME_SIMD_SSE
+    } // namespace SIMD
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,340 @@
+#pragma once
+
+#include "Core/CoreTypes.h"
+#include "Core/Math/TVector3.h"
+#include "Core/Math/TMatrix4x4.h"
+#include "Core/Math/SIMD/MatrixSIMD.h"
+#include "MathConstants.h"
+
+namespace TDME
+{
+    /**
+     * @brief 3x4 아핀(Affine) 행렬 클래스
+     * @details 마지막 열이 항상 (0, 0, 0, 1) 인 TMatrix4x4 를 전치하여 위의 3행만 저장 (Row-major, 48바이트)
+     * @li TMatrix4x4 의 i 번째 열 = TMatrix3x4 의 i 번째 행 → 각 행 = (X축.i, Y축.i, Z축.i, 이동.i)
+     * @li 암묵적인 4번째 행 = (0, 0, 0, 1)
+     * @li HLSL 의 row_major float3x4 와 같은 배치이므로 상수 버퍼에 그대로 업로드 가능 (4x4 대비 16바이트 절약)
+     * @note 곱셈 순서는 TMatrix4x4 와 같음: (A * B).ToMatrix() == A.ToMatrix() * B.ToMatrix() (A 를 먼저 적용)
+     * @tparam T 행렬 요소 타입
+     */
+    template <typename T>
+    struct TMatrix3x4
+    {
+#pragma warning(push)
+#pragma warning(disable : 4201) // 익명 구조체/공용체 사용에 대한 경고 비활성화
+        union
+        {
+            struct
+            {
+                T _11, _12, _13, _14;
+                T _21, _22, _23, _24;
+                T _31, _32, _33, _34;
+            };
+            struct
+            {
+                T Xx, Yx, Zx, Tx; // 각 축 / 이동 벡터의 x 성분
+                T Xy, Yy, Zy, Ty; // 각 축 / 이동 벡터의 y 성분
+                T Xz, Yz, Zz, Tz; // 각 축 / 이동 벡터의 z 성분
+            };
+            T M[3][4];
+            T Data[12]; // GPU 전달용 1D 배열
+        };
+#pragma warning(pop)
+
+        constexpr TMatrix3x4() : Data{} {}
+
+        constexpr TMatrix3x4(T m11, T m12, T m13, T m14,
+                             T m21, T m22, T m23, T m24,
+                             T m31, T m32, T m33, T m34)
+            : _11(m11), _12(m12), _13(m13), _14(m14),
+              _21(m21), _22(m22), _23(m23), _24(m24),
+              _31(m31), _32(m32), _33(m33), _34(m34) {}
+
+        //////////////////////////////////////////////////////////////
+        // 변환
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 4x4 행렬에서 생성
+         * @note 마지막 열은 (0, 0, 0, 1) 이라고 가정하고 버림 (TMatrix4x4::IsAffine() 참고)
+         * @param matrix 아핀 4x4 행렬
+         * @return TMatrix3x4 3x4 행렬
+         */
+        static constexpr TMatrix3x4 FromMatrix(const TMatrix4x4<T>& matrix)
+        {
+            return TMatrix3x4(
+                matrix._11, matrix._21, matrix._31, matrix._41,
+                matrix._12, matrix._22, matrix._32, matrix._42,
+                matrix._13, matrix._23, matrix._33, matrix._43);
+        }
+
+        /**
+         * @brief 4x4 행렬로 변환
+         * @return TMatrix4x4<T> 마지막 열이 (0, 0, 0, 1) 인 4x4 행렬
+         */
+        constexpr TMatrix4x4<T> ToMatrix() const
+        {
+            return TMatrix4x4<T>(
+                Xx, Xy, Xz, T(0),
+                Yx, Yy, Yz, T(0),
+                Zx, Zy, Zz, T(0),
+                Tx, Ty, Tz, T(1));
+        }
+
+        /**
+         * @brief 점 변환 (이동 포함)
+         * @param point 변환할 점
+         * @return TVector3<T> 변환된 점
+         */
+        constexpr TVector3<T> TransformPosition(const TVector3<T>& point) const
+        {
+            return TVector3<T>(
+                _11 * point.X + _12 * point.Y + _13 * point.Z + _14,
+                _21 * point.X + _22 * point.Y + _23 * point.Z + _24,
+                _31 * point.X + _32 * point.Y + _33 * point.Z + _34);
+        }
+
+        /**
+         * @brief 방향 벡터 변환 (이동 제외)
+         * @param vector 변환할 벡터
+         * @return TVector3<T> 변환된 벡터
+         */
+        constexpr TVector3<T> TransformVector(const TVector3<T>& vector) const
+        {
+            return TVector3<T>(
+                _11 * vector.X + _12 * vector.Y + _13 * vector.Z,
+                _21 * vector.X + _22 * vector.Y + _23 * vector.Z,
+                _31 * vector.X + _32 * vector.Y + _33 * vector.Z);
+        }
+
+        //////////////////////////////////////////////////////////////
+        // Getter / Setter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief X 축 (TMatrix4x4 의 1행) 반환
+         */
+        constexpr TVector3<T> GetAxisX() const { return TVector3<T>(Xx, Xy, Xz); }
+
+        /**
+         * @brief Y 축 (TMatrix4x4 의 2행) 반환
+         */
+        constexpr TVector3<T> GetAxisY() const { return TVector3<T>(Yx, Yy, Yz); }
+
+        /**
+         * @brief Z 축 (TMatrix4x4 의 3행) 반환
+         */
+        constexpr TVector3<T> GetAxisZ() const { return TVector3<T>(Zx, Zy, Zz); }
+
+        /**
+         * @brief 행렬의 이동 벡터를 반환
+         * @return TVector3<T> 행렬의 이동 벡터
+         */
+        constexpr TVector3<T> GetTranslationVector() const
+        {
+            return TVector3<T>(Tx, Ty, Tz);
+        }
+
+        /**
+         * @brief 행렬의 이동 벡터를 설정
+         * @param translation 이동 벡터
+         */
+        constexpr void SetTranslationVector(const TVector3<T>& translation)
+        {
+            Tx = translation.X;
+            Ty = translation.Y;
+            Tz = translation.Z;
+        }
+
+        /**
+         * @brief 3x3 부분 행렬의 행렬식 반환 (역행렬 존재 여부 확인용)
+         * @return T 행렬식
+         */
+        constexpr T Determinant() const
+        {
+            return _11 * (_22 * _33 - _23 * _32)
+                 - _12 * (_21 * _33 - _23 * _31)
+                 + _13 * (_21 * _32 - _22 * _31);
+        }
+
+        /**
+         * @brief 역행렬 반환
+         * @details M = | L t |  →  M^-1 = | L^-1  -L^-1 * t |
+         * @li 3x3 부분 행렬(L)의 역행렬만 계산 (TMatrix4x4::InverseAffine() 과 같은 결과)
+         * @note 행렬식이 0에 가까우면 단위 행렬 반환
+         * @return TMatrix3x4 역행렬
+         */
+        constexpr TMatrix3x4 Inverse() const
+        {
+            // 3x3 여인수
+            T c11 = _22 * _33 - _23 * _32;
+            T c21 = _23 * _31 - _21 * _33;
+            T c31 = _21 * _32 - _22 * _31;
+
+            T det = _11 * c11 + _12 * c21 + _13 * c31;
+            if (det > T(-Math::SmallNumber) && det < T(Math::SmallNumber))
+            {
+                return Identity();
+            }
+            T invDet = T(1) / det;
+
+            TMatrix3x4 result;
+
+            result._11 = c11 * invDet;
+            result._12 = (_13 * _32 - _12 * _33) * invDet;
+            result._13 = (_12 * _23 - _13 * _22) * invDet;
+
+            result._21 = c21 * invDet;
+            result._22 = (_11 * _33 - _13 * _31) * invDet;
+            result._23 = (_13 * _21 - _11 * _23) * invDet;
+
+            result._31 = c31 * invDet;
+            result._32 = (_12 * _31 - _11 * _32) * invDet;
+            result._33 = (_11 * _22 - _12 * _21) * invDet;
+
+            // -L^-1 * t
+            result._14 = -(result._11 * _14 + result._12 * _24 + result._13 * _34);
+            result._24 = -(result._21 * _14 + result._22 * _24 + result._23 * _34);
+            result._34 = -(result._31 * _14 + result._32 * _24 + result._33 * _34);
+
+            return result;
+        }
+
+        /**
+         * @brief 강체(Rigid) 변환 행렬의 역행렬 반환
+         * @details 회전 + 이동으로만 구성된 행렬은 회전 부분이 직교 행렬이므로 전치로 역행렬을 구함
+         * @note 스케일/전단이 있으면 잘못된 결과를 반환하므로 Inverse() 사용
+         * @return TMatrix3x4 역행렬
+         */
+        constexpr TMatrix3x4 InverseRigid() const
+        {
+            return TMatrix3x4(
+                _11, _21, _31, -(_11 * _14 + _21 * _24 + _31 * _34),
+                _12, _22, _32, -(_12 * _14 + _22 * _24 + _32 * _34),
+                _13, _23, _33, -(_13 * _14 + _23 * _24 + _33 * _34));
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 연산자 오버로딩
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 두 아핀 행렬의 곱을 반환
+         * @details TMatrix4x4 와 같은 순서 (this 를 먼저 적용하고 other 를 나중에 적용)
+         * @li 4x4 곱(곱셈 64회) 대비 곱셈 36회
+         * @param other 나중에 적용할 행렬
+         * @return TMatrix3x4 두 행렬의 곱 결과
+         */
+        constexpr TMatrix3x4 operator*(const TMatrix3x4& other) const
+        {
+            TMatrix3x4 result;
+            for (size_t row = 0; row < 3; row++)
+            {
+                for (size_t col = 0; col < 4; col++)
+                {
+                    result.M[row][col] = other.M[row][0] * M[0][col]
+                                       + other.M[row][1] * M[1][col]
+                                       + other.M[row][2] * M[2][col];
+                }
+                result.M[row][3] += other.M[row][3];
+            }
+            return result;
+        }
+
+        /**
+         * @brief 두 아핀 행렬의 곱을 계산하여 자기 자신에 저장
+         * @param other 나중에 적용할 행렬
+         * @return TMatrix3x4& 자기 자신의 참조
+         */
+        TMatrix3x4& operator*=(const TMatrix3x4& other)
+        {
+            *this = *this * other;
+            return *this;
+        }
+
+        /**
+         * @brief 두 행렬이 같은지 확인
+         * @param other 다른 행렬
+         * @return bool 두 행렬이 같은지 여부
+         */
+        constexpr bool operator==(const TMatrix3x4& other) const
+        {
+            for (size_t i = 0; i < 12; i++)
+            {
+                if (Data[i] != other.Data[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief 두 행렬이 다른지 확인
+         * @param other 다른 행렬
+         * @return bool 두 행렬이 다른지 여부
+         */
+        constexpr bool operator!=(const TMatrix3x4& other) const
+        {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief 행렬의 행을 반환
+         * @param row 행 인덱스
+         * @return T* 행렬의 행 참조
+         */
+        T* operator[](size_t row) { return M[row]; }
+
+        /**
+         * @brief 행렬의 행을 반환
+         * @param row 행 인덱스
+         * @return const T* 행렬의 행 상수 참조
+         */
+        const T* operator[](size_t row) const { return M[row]; }
+
+        //////////////////////////////////////////////////////////////
+        // 미리 정의된 행렬
+        //////////////////////////////////////////////////////////////
+
+        static constexpr TMatrix3x4 Zero() { return TMatrix3x4(); }
+        static constexpr TMatrix3x4 Identity() { return TMatrix3x4(T(1), T(0), T(0), T(0),
+                                                                   T(0), T(1), T(0), T(0),
+                                                                   T(0), T(0), T(1), T(0)); }
+    };
+
+#if TDME_SIMD_SSE
+    //////////////////////////////////////////////////////////////
+    // float 특수화 (SIMD)
+    // NOTE: 특수화된 함수는 constexpr 이 아니므로 float 행렬의 곱/역행렬은 런타임에서만 사용 가능
+    //////////////////////////////////////////////////////////////
+
+    template <>
+    inline TMatrix3x4<float> TMatrix3x4<float>::Inverse() const
+    {
+        TMatrix3x4<float> result;
+        if (!SIMD::Matrix3x4Inverse(Data, result.Data))
+        {
+            return Identity();
+        }
+        return result;
+    }
+
+    template <>
+    inline TMatrix3x4<float> TMatrix3x4<float>::operator*(const TMatrix3x4<float>& other) const
+    {
+        TMatrix3x4<float> result;
+        SIMD::Matrix3x4Multiply(Data, other.Data, result.Data);
+        return result;
+    }
+#endif // TDME_SIMD_SSE
+
+    //////////////////////////////////////////////////////////////
+    // 타입 별칭
+    //////////////////////////////////////////////////////////////
+
+    using Matrix3x4F = TMatrix3x4<float>;  // float 3x4 아핀 행렬
+    using Matrix3x4D = TMatrix3x4<double>; // double 3x4 아핀 행렬
+    using Matrix3x4  = Matrix3x4F;         // 기본 타입은 float
+
+} // namespace TDME
\ No newline at end of file
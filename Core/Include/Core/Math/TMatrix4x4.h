@@ -4,6 +4,7 @@
 #include "Core/Math/TVector2.h"
 #include "Core/Math/TVector3.h"
 #include "Core/Math/TVector4.h"
+#include "Core/Math/SIMD/MatrixSIMD.h"
 #include "MathConstants.h"
 
 namespace TDME
@@ -108,10 +109,16 @@ namespace TDME
 
         /**
          * @brief 역행렬 반환
+         * @details 아핀 행렬이면 InverseAffine() 경로를 자동으로 사용
          * @return TMatrix4x4 역행렬
          */
         constexpr TMatrix4x4 Inverse() const
         {
+            if (IsAffine())
+            {
+                return InverseAffine();
+            }
+
             T det = Determinant();
             if (det > T(-Math::SmallNumber) && det < T(Math::SmallNumber))
             {
@@ -145,6 +152,81 @@ namespace TDME
             return result;
         }
 
+        /**
+         * @brief 아핀(Affine) 행렬 여부 확인
+         * @details 마지막 열이 (0, 0, 0, 1) 이면 회전/스케일/전단 + 이동으로만 구성된 행렬
+         * @return bool 아핀 행렬 여부
+         */
+        constexpr bool IsAffine() const
+        {
+            return _14 == T(0) && _24 == T(0) && _34 == T(0) && _44 == T(1);
+        }
+
+        /**
+         * @brief 아핀 행렬의 역행렬 반환
+         * @details M = | A 0 |  →  M^-1 = | A^-1       0 |
+         * @li          | t 1 |            | -t * A^-1  1 |
+         * @li 3x3 부분 행렬(A)의 역행렬만 계산하므로 일반 역행렬보다 빠름
+         * @note 마지막 열이 (0, 0, 0, 1) 이라고 가정 (IsAffine() 참고). 행렬식이 0에 가까우면 단위 행렬 반환
+         * @return TMatrix4x4 역행렬
+         */
+        constexpr TMatrix4x4 InverseAffine() const
+        {
+            // 3x3 여인수
+            T c11 = _22 * _33 - _23 * _32;
+            T c12 = _23 * _31 - _21 * _33;
+            T c13 = _21 * _32 - _22 * _31;
+
+            T det = _11 * c11 + _12 * c12 + _13 * c13;
+            if (det > T(-Math::SmallNumber) && det < T(Math::SmallNumber))
+            {
+                return Identity();
+            }
+            T invDet = T(1) / det;
+
+            TMatrix4x4 result;
+
+            result._11 = c11 * invDet;
+            result._12 = (_13 * _32 - _12 * _33) * invDet;
+            result._13 = (_12 * _23 - _13 * _22) * invDet;
+
+            result._21 = c12 * invDet;
+            result._22 = (_11 * _33 - _13 * _31) * invDet;
+            result._23 = (_13 * _21 - _11 * _23) * invDet;
+
+            result._31 = c13 * invDet;
+            result._32 = (_12 * _31 - _11 * _32) * invDet;
+            result._33 = (_11 * _22 - _12 * _21) * invDet;
+
+            // -t * A^-1
+            result._41 = -(_41 * result._11 + _42 * result._21 + _43 * result._31);
+            result._42 = -(_41 * result._12 + _42 * result._22 + _43 * result._32);
+            result._43 = -(_41 * result._13 + _42 * result._23 + _43 * result._33);
+            result._44 = T(1);
+
+            return result;
+        }
+
+        /**
+         * @brief 강체(Rigid) 변환 행렬의 역행렬 반환
+         * @details 회전 + 이동으로만 구성된 행렬은 회전 부분이 직교 행렬이므로 전치로 역행렬을 구함
+         * @li M = | R 0 |  →  M^-1 = | R^T       0 |
+         * @li     | t 1 |            | -t * R^T  1 |
+         * @note 스케일/전단이 있으면 잘못된 결과를 반환하므로 InverseAffine() 사용
+         * @return TMatrix4x4 역행렬
+         */
+        constexpr TMatrix4x4 InverseRigid() const
+        {
+            return TMatrix4x4(
+                _11, _21, _31, T(0),
+                _12, _22, _32, T(0),
+                _13, _23, _33, T(0),
+                -(_41 * _11 + _42 * _12 + _43 * _13),
+                -(_41 * _21 + _42 * _22 + _43 * _23),
+                -(_41 * _31 + _42 * _32 + _43 * _33),
+                T(1));
+        }
+
         //////////////////////////////////////////////////////////////
         // 연산자 오버로딩
         //////////////////////////////////////////////////////////////
@@ -297,6 +379,58 @@ namespace TDME
         }
     };
 
+#if TDME_SIMD_SSE
+    //////////////////////////////////////////////////////////////
+    // float 특수화 (SIMD)
+    // 컴파일 타임에 SSE/AVX 가 감지되면 곱셈/전치/역행렬/아핀 역행렬을 SIMD 커널로 대체.
+    // 감지되지 않으면 (TDME_SIMD_DISABLE 포함) 위의 스칼라 구현을 그대로 사용.
+    // NOTE: 특수화된 함수는 constexpr 이 아니므로 float 행렬의 곱/전치/역행렬은 런타임에서만 사용 가능
+    //////////////////////////////////////////////////////////////
+
+    template <>
+    inline TMatrix4x4<float> TMatrix4x4<float>::Transposed() const
+    {
+        TMatrix4x4<float> result;
+        SIMD::MatrixTranspose(Data, result.Data);
+        return result;
+    }
+
+    template <>
+    inline TMatrix4x4<float> TMatrix4x4<float>::InverseAffine() const
+    {
+        TMatrix4x4<float> result;
+        if (!SIMD::MatrixInverseAffine(Data, result.Data))
+        {
+            return Identity();
+        }
+        return result;
+    }
+
+    template <>
+    inline TMatrix4x4<float> TMatrix4x4<float>::Inverse() const
+    {
+        if (IsAffine())
+        {
+            return InverseAffine();
+        }
+
+        TMatrix4x4<float> result;
+        if (!SIMD::MatrixInverse(Data, result.Data))
+        {
+            return Identity();
+        }
+        return result;
+    }
+
+    template <>
+    inline TMatrix4x4<float> TMatrix4x4<float>::operator*(const TMatrix4x4<float>& other) const
+    {
+        TMatrix4x4<float> result;
+        SIMD::MatrixMultiply(Data, other.Data, result.Data);
+        return result;
+    }
+#endif // TDME_SIMD_SSE
+
     //////////////////////////////////////////////////////////////
     // 타입 별칭
     //////////////////////////////////////////////////////////////
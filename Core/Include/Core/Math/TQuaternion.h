@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/CoreMacros.h"
+#include "Core/Math/MathUtils.h"
 #include "Core/Math/TVector3.h"
 #include "MathConstants.h"
 #include "TVector3.h"
@@ -247,9 +248,8 @@ namespace TDME
          */
         static constexpr TQuaternion FromAxisAngle(const TVector3<T>& axis, T angleRad)
         {
-            T halfAngle = angleRad * T(0.5);
-            T sinHalf   = std::sin(halfAngle);
-            T cosHalf   = std::cos(halfAngle);
+            T sinHalf = T(0), cosHalf = T(0);
+            Math::SinCos(angleRad * T(0.5), sinHalf, cosHalf);
 
             return TQuaternion(axis.X * sinHalf, axis.Y * sinHalf, axis.Z * sinHalf, cosHalf);
         }
@@ -264,16 +264,12 @@ namespace TDME
          */
         static constexpr TQuaternion FromEuler(T pitch, T yaw, T roll)
         {
-            T halfPitch = pitch * T(0.5); // X
-            T halfYaw   = yaw * T(0.5);   // Y
-            T halfRoll  = roll * T(0.5);  // Z
-
-            T cosPitch = std::cos(halfPitch);
-            T sinPitch = std::sin(halfPitch);
-            T cosYaw   = std::cos(halfYaw);
-            T sinYaw   = std::sin(halfYaw);
-            T cosRoll  = std::cos(halfRoll);
-            T sinRoll  = std::sin(halfRoll);
+            T sinPitch = T(0), cosPitch = T(0);
+            T sinYaw   = T(0), cosYaw   = T(0);
+            T sinRoll  = T(0), cosRoll  = T(0);
+            Math::SinCos(pitch * T(0.5), sinPitch, cosPitch); // X
+            Math::SinCos(yaw * T(0.5), sinYaw, cosYaw);       // Y
+            Math::SinCos(roll * T(0.5), sinRoll, cosRoll);    // Z
 
             return TQuaternion(
                 cosYaw * sinPitch * cosRoll + sinYaw * cosPitch * sinRoll, // X
@@ -290,8 +286,9 @@ namespace TDME
          */
         static constexpr TQuaternion FromRotationX(T angleRad)
         {
-            T halfAngle = angleRad * T(0.5);
-            return TQuaternion(std::sin(halfAngle), T(0), T(0), std::cos(halfAngle));
+            T s = T(0), c = T(0);
+            Math::SinCos(angleRad * T(0.5), s, c);
+            return TQuaternion(s, T(0), T(0), c);
         }
 
         /**
@@ -301,8 +298,9 @@ namespace TDME
          */
         static constexpr TQuaternion FromRotationY(T angleRad)
         {
-            T halfAngle = angleRad * T(0.5);
-            return TQuaternion(T(0), std::sin(halfAngle), T(0), std::cos(halfAngle));
+            T s = T(0), c = T(0);
+            Math::SinCos(angleRad * T(0.5), s, c);
+            return TQuaternion(T(0), s, T(0), c);
         }
 
         /**
@@ -312,8 +310,9 @@ namespace TDME
          */
         static constexpr TQuaternion FromRotationZ(T angleRad)
         {
-            T halfAngle = angleRad * T(0.5);
-            return TQuaternion(T(0), T(0), std::sin(halfAngle), std::cos(halfAngle));
+            T s = T(0), c = T(0);
+            Math::SinCos(angleRad * T(0.5), s, c);
+            return TQuaternion(T(0), T(0), s, c);
         }
 
         //////////////////////////////////////////////////////////////
@@ -1,9 +1,11 @@
 #pragma once
 
+#include "Core/Math/MathUtils.h"
 #include "Core/Math/TVector2.h"
 #include "TVector2.h"
 #include "TVector3.h"
 #include "TQuaternion.h"
+#include "TMatrix3x4.h"
 #include "TMatrix4x4.h"
 #include "Transformations.h"
 
@@ -26,22 +28,95 @@ namespace TDME
 
         /**
          * @brief Transform을 행렬로 변환
-         * @details SRT (Scale * Rotation * Translation) 행렬 계산
+         * @details SRT (Scale * Rotation * Translation) 행렬을 행렬 곱 없이 직접 계산
+         * @li 1~3행: 쿼터니언 회전 행렬의 각 행(축)에 Scale.X/Y/Z 를 곱한 값
+         * @li 4행: Position (이동 벡터)
          * @return Matrix 변환된 행렬
          */
-        Matrix ToMatrix() const
+        constexpr Matrix ToMatrix() const
         {
-            // 1. 스케일 행렬
-            Matrix scaleMatrix = ScaleMatrix(Scale.X, Scale.Y, Scale.Z);
+            const float x = Rotation.X, y = Rotation.Y, z = Rotation.Z, w = Rotation.W;
+
+            const float xx = x * x, yy = y * y, zz = z * z;
+            const float xy = x * y, xz = x * z, yz = y * z;
+            const float wx = w * x, wy = w * y, wz = w * z;
+
+            return Matrix(
+                (1.0f - 2.0f * (yy + zz)) * Scale.X, 2.0f * (xy + wz) * Scale.X, 2.0f * (xz - wy) * Scale.X, 0.0f, // X 축 * Scale.X
+                2.0f * (xy - wz) * Scale.Y, (1.0f - 2.0f * (xx + zz)) * Scale.Y, 2.0f * (yz + wx) * Scale.Y, 0.0f, // Y 축 * Scale.Y
+                2.0f * (xz + wy) * Scale.Z, 2.0f * (yz - wx) * Scale.Z, (1.0f - 2.0f * (xx + yy)) * Scale.Z, 0.0f, // Z 축 * Scale.Z
+                Position.X, Position.Y, Position.Z, 1.0f                                                          // 이동
+            );
+        }
 
-            // 2. 회전 행렬 (쿼터니언 => 행렬)
-            Matrix rotationMatrix = Quaternion::ToMatrix(Rotation);
+        /**
+         * @brief Transform을 3x4 아핀 행렬로 변환
+         * @details ToMatrix() 의 전치 중 위 3행 (각 열 = 축 * Scale, 마지막 열 = Position)
+         * @return Matrix3x4 변환된 행렬
+         */
+        constexpr Matrix3x4 ToMatrix3x4() const
+        {
+            const float x = Rotation.X, y = Rotation.Y, z = Rotation.Z, w = Rotation.W;
+
+            const float xx = x * x, yy = y * y, zz = z * z;
+            const float xy = x * y, xz = x * z, yz = y * z;
+            const float wx = w * x, wy = w * y, wz = w * z;
+
+            return Matrix3x4(
+                (1.0f - 2.0f * (yy + zz)) * Scale.X, 2.0f * (xy - wz) * Scale.Y, 2.0f * (xz + wy) * Scale.Z, Position.X,
+                2.0f * (xy + wz) * Scale.X, (1.0f - 2.0f * (xx + zz)) * Scale.Y, 2.0f * (yz - wx) * Scale.Z, Position.Y,
+                2.0f * (xz - wy) * Scale.X, 2.0f * (yz + wx) * Scale.Y, (1.0f - 2.0f * (xx + yy)) * Scale.Z, Position.Z);
+        }
 
-            // 3. 이동 행렬
-            Matrix translationMatrix = TranslationMatrix(Position);
+        /**
+         * @brief 점을 Transform으로 변환 (Scale → Rotation → Translation 순서)
+         * @param point 변환할 점
+         * @return Vector3 변환된 점
+         */
+        constexpr Vector3 TransformPosition(const Vector3& point) const
+        {
+            return Rotation.RotateVector(point * Scale) + Position;
+        }
 
-            // SRT 행렬 계산
-            return scaleMatrix * rotationMatrix * translationMatrix;
+        /**
+         * @brief 방향 벡터를 Transform으로 변환 (이동 제외)
+         * @param vector 변환할 벡터
+         * @return Vector3 변환된 벡터
+         */
+        constexpr Vector3 TransformVector(const Vector3& vector) const
+        {
+            return Rotation.RotateVector(vector * Scale);
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 연산자 오버로딩
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 두 Transform 합성 (TRS 공간 유지)
+         * @details 행렬 곱과 같은 순서: (A * B).ToMatrix() == A.ToMatrix() * B.ToMatrix()
+         *          - 로컬 → 부모 공간: child * parent
+         * @note 부모의 스케일이 비균등(non-uniform)이고 자식에 회전이 있으면 행렬 곱은 전단(Shear)을 만들며,
+         *       TRS 로는 표현할 수 없으므로 스케일은 성분별 곱으로 근사함.
+         * @param parent 나중에 적용할 (부모) Transform
+         * @return Transform 합성된 Transform
+         */
+        constexpr Transform operator*(const Transform& parent) const
+        {
+            return Transform(parent.TransformPosition(Position),
+                             parent.Rotation * Rotation,
+                             Scale * parent.Scale);
+        }
+
+        /**
+         * @brief 두 Transform 합성 결과를 자기 자신에 저장
+         * @param parent 나중에 적용할 (부모) Transform
+         * @return Transform& 자기 자신의 참조
+         */
+        constexpr Transform& operator*=(const Transform& parent)
+        {
+            *this = *this * parent;
+            return *this;
         }
 
         //////////////////////////////////////////////////////////////
@@ -108,7 +183,7 @@ namespace TDME
         float GetRotation2D() const
         {
             // 쿼터니언에서 Z축 회전 각도 추출
-            return 2.0f * std::atan2(Rotation.Z, Rotation.W);
+            return 2.0f * Math::Atan2(Rotation.Z, Rotation.W);
         }
 
         /**
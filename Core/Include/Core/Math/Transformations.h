@@ -5,6 +5,9 @@
 #include "Core/Math/TMatrix4x4.h"
 #include "Core/Math/TVector2.h"
 #include "Core/Math/TVector3.h"
+#include "Core/Math/SIMD/TransformSIMD.h"
+
+#include <type_traits>
 
 namespace TDME
 {
@@ -241,6 +244,182 @@ namespace TDME
                            vector.X * matrix._12 + vector.Y * matrix._22);
     }
 
+    //////////////////////////////////////////////////////////////
+    // 배열 변환 함수 (Batch)
+    // 컬링, 파티클, CPU 정점 변환처럼 많은 점/방향을 한 번에 변환할 때 사용.
+    // float 은 SIMD 커널(AVX: 8개, SSE: 4개 단위)을 사용하고 그 외 타입은 스칼라 루프로 처리.
+    // NOTE: 아핀 행렬을 가정하여 4번째 열(W)과 원근 나눗셈은 무시 (원근 투영이 필요하면 TransformPosition 사용)
+    // NOTE: 입력과 출력이 같은 배열(In-place)이어도 안전
+    //////////////////////////////////////////////////////////////
+
+    /**
+     * @brief 3D 점 배열 변환 (AoS)
+     * @tparam T 행렬 요소 타입
+     * @param points 변환할 점 배열
+     * @param outPoints 변환된 점을 저장할 배열
+     * @param count 점 개수
+     * @param matrix 변환 행렬
+     */
+    template <typename T>
+    INLINE void TransformPositions(const TVector3<T>* points, TVector3<T>* outPoints, size_t count, const TMatrix4x4<T>& matrix)
+    {
+#if TDME_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            static_assert(sizeof(TVector3<float>) == sizeof(float) * 3, "TVector3<float> must be tightly packed");
+            SIMD::TransformAoS(reinterpret_cast<const float*>(points), reinterpret_cast<float*>(outPoints), count, matrix.Data, 1.0f);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            const TVector3<T> p = points[i];
+            outPoints[i]        = TVector3<T>(p.X * matrix._11 + p.Y * matrix._21 + p.Z * matrix._31 + matrix._41,
+                                              p.X * matrix._12 + p.Y * matrix._22 + p.Z * matrix._32 + matrix._42,
+                                              p.X * matrix._13 + p.Y * matrix._23 + p.Z * matrix._33 + matrix._43);
+        }
+    }
+
+    /**
+     * @brief 3D 벡터 배열 변환 (AoS, 이동 제외)
+     * @tparam T 행렬 요소 타입
+     * @param vectors 변환할 벡터 배열
+     * @param outVectors 변환된 벡터를 저장할 배열
+     * @param count 벡터 개수
+     * @param matrix 변환 행렬
+     */
+    template <typename T>
+    INLINE void TransformVectors(const TVector3<T>* vectors, TVector3<T>* outVectors, size_t count, const TMatrix4x4<T>& matrix)
+    {
+#if TDME_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            SIMD::TransformAoS(reinterpret_cast<const float*>(vectors), reinterpret_cast<float*>(outVectors), count, matrix.Data, 0.0f);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            outVectors[i] = TransformVector(vectors[i], matrix);
+        }
+    }
+
+    /**
+     * @brief 3D 점 배열을 각각 대응되는 행렬로 변환 (outPoints[i] = points[i] * matrices[i])
+     * @tparam T 행렬 요소 타입
+     * @param points 변환할 점 배열
+     * @param matrices 변환 행렬 배열 (points 와 같은 개수)
+     * @param outPoints 변환된 점을 저장할 배열
+     * @param count 점 개수
+     */
+    template <typename T>
+    INLINE void TransformPositions(const TVector3<T>* points, const TMatrix4x4<T>* matrices, TVector3<T>* outPoints, size_t count)
+    {
+#if TDME_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            static_assert(sizeof(TMatrix4x4<float>) == sizeof(float) * 16, "TMatrix4x4<float> must be tightly packed");
+            SIMD::TransformAoSPerMatrix(reinterpret_cast<const float*>(points), reinterpret_cast<const float*>(matrices), reinterpret_cast<float*>(outPoints), count, 1.0f);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            const TVector3<T>    p = points[i];
+            const TMatrix4x4<T>& m = matrices[i];
+            outPoints[i]           = TVector3<T>(p.X * m._11 + p.Y * m._21 + p.Z * m._31 + m._41,
+                                                 p.X * m._12 + p.Y * m._22 + p.Z * m._32 + m._42,
+                                                 p.X * m._13 + p.Y * m._23 + p.Z * m._33 + m._43);
+        }
+    }
+
+    /**
+     * @brief 3D 벡터 배열을 각각 대응되는 행렬로 변환 (이동 제외)
+     * @tparam T 행렬 요소 타입
+     * @param vectors 변환할 벡터 배열
+     * @param matrices 변환 행렬 배열 (vectors 와 같은 개수)
+     * @param outVectors 변환된 벡터를 저장할 배열
+     * @param count 벡터 개수
+     */
+    template <typename T>
+    INLINE void TransformVectors(const TVector3<T>* vectors, const TMatrix4x4<T>* matrices, TVector3<T>* outVectors, size_t count)
+    {
+#if TDME_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            SIMD::TransformAoSPerMatrix(reinterpret_cast<const float*>(vectors), reinterpret_cast<const float*>(matrices), reinterpret_cast<float*>(outVectors), count, 0.0f);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            outVectors[i] = TransformVector(vectors[i], matrices[i]);
+        }
+    }
+
+    /**
+     * @brief 3D 점 배열 변환 (SoA, X/Y/Z 가 분리된 배열)
+     * @details SIMD 레지스터에 재배치 없이 바로 적재되므로 AoS 보다 빠름
+     * @tparam T 행렬 요소 타입
+     * @param inX 입력 X 배열
+     * @param inY 입력 Y 배열
+     * @param inZ 입력 Z 배열
+     * @param outX 출력 X 배열
+     * @param outY 출력 Y 배열
+     * @param outZ 출력 Z 배열
+     * @param count 점 개수
+     * @param matrix 변환 행렬
+     */
+    template <typename T>
+    INLINE void TransformPositionsSoA(const T* inX, const T* inY, const T* inZ, T* outX, T* outY, T* outZ, size_t count, const TMatrix4x4<T>& matrix)
+    {
+#if TDME_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            SIMD::TransformSoA(inX, inY, inZ, outX, outY, outZ, count, matrix.Data, 1.0f);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            const T x = inX[i], y = inY[i], z = inZ[i];
+            outX[i]   = x * matrix._11 + y * matrix._21 + z * matrix._31 + matrix._41;
+            outY[i]   = x * matrix._12 + y * matrix._22 + z * matrix._32 + matrix._42;
+            outZ[i]   = x * matrix._13 + y * matrix._23 + z * matrix._33 + matrix._43;
+        }
+    }
+
+    /**
+     * @brief 3D 벡터 배열 변환 (SoA, 이동 제외)
+     * @tparam T 행렬 요소 타입
+     * @param inX 입력 X 배열
+     * @param inY 입력 Y 배열
+     * @param inZ 입력 Z 배열
+     * @param outX 출력 X 배열
+     * @param outY 출력 Y 배열
+     * @param outZ 출력 Z 배열
+     * @param count 벡터 개수
+     * @param matrix 변환 행렬
+     */
+    template <typename T>
+    INLINE void TransformVectorsSoA(const T* inX, const T* inY, const T* inZ, T* outX, T* outY, T* outZ, size_t count, const TMatrix4x4<T>& matrix)
+    {
+#if TDME_SIMD_SSE
+        if constexpr (std::is_same_v<T, float>)
+        {
+            SIMD::TransformSoA(inX, inY, inZ, outX, outY, outZ, count, matrix.Data, 0.0f);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < count; i++)
+        {
+            const T x = inX[i], y = inY[i], z = inZ[i];
+            outX[i]   = x * matrix._11 + y * matrix._21 + z * matrix._31;
+            outY[i]   = x * matrix._12 + y * matrix._22 + z * matrix._32;
+            outZ[i]   = x * matrix._13 + y * matrix._23 + z * matrix._33;
+        }
+    }
+
     //////////////////////////////////////////////////////////////
     // 뷰 행렬 생성
     //////////////////////////////////////////////////////////////
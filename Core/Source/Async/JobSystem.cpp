@@ -0,0 +1,316 @@
+#include "pch.h"
+#include "Core/Async/JobSystem.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace TDME
+{
+    /**
+     * @brief 현재 스레드가 등록된 작업 시스템과 그 안의 스레드 인덱스
+     */
+    struct JobThreadBinding
+    {
+        const JobSystem* System = nullptr;
+        uint32           Index  = 0;
+    };
+
+    static thread_local JobThreadBinding t_threadBinding;
+    static thread_local uint32           t_stealSeed = 0; // 훔칠 덱을 고르는 xorshift 상태 (스레드마다 다른 순서로 시작)
+
+    /**
+     * @brief 훔칠 덱의 시작 인덱스 선택용 난수 (xorshift32)
+     */
+    static uint32 NextStealRandom()
+    {
+        uint32 x = t_stealSeed;
+        if (x == 0)
+        {
+            x = static_cast<uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+        }
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        t_stealSeed = x;
+        return x;
+    }
+
+    JobSystem::JobSystem(uint32 workerCount)
+    {
+        m_deques.reserve(workerCount + 1);
+        for (uint32 i = 0; i <= workerCount; i++)
+        {
+            m_deques.push_back(std::make_unique<WorkStealingDeque<Job*>>(DequeCapacity));
+        }
+
+        m_jobPools.reserve(workerCount + 2);
+        for (uint32 i = 0; i <= workerCount + 1; i++)
+        {
+            m_jobPools.push_back(std::make_unique<JobPool>());
+        }
+
+        // 이미 다른 작업 시스템의 스레드면 등록하지 않음 (이 시스템에는 공용 큐로 작업을 넣음)
+        if (t_threadBinding.System == nullptr)
+        {
+            t_threadBinding = { this, 0 };
+        }
+
+        m_workers.reserve(workerCount);
+        for (uint32 i = 0; i < workerCount; i++)
+        {
+            m_workers.emplace_back([this, i] { WorkerMain(i + 1); });
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_isStopping.store(true);
+        }
+        m_wakeCondition.notify_all();
+
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+
+        if (t_threadBinding.System == this)
+        {
+            t_threadBinding = {};
+        }
+    }
+
+    uint32 JobSystem::GetDefaultWorkerCount()
+    {
+        const uint32 hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    uint32 JobSystem::GetCurrentThreadIndex() const
+    {
+        return t_threadBinding.System == this ? t_threadBinding.Index : InvalidThreadIndex;
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 작업 실행
+    //////////////////////////////////////////////////////////////
+
+    void JobSystem::Run(JobFunction function, void* context, JobCounter& counter, uint32 begin, uint32 end)
+    {
+        counter.m_pendingCount.fetch_add(1, std::memory_order_relaxed);
+
+        const uint32 threadIndex = GetCurrentThreadIndex();
+        if (threadIndex == InvalidThreadIndex)
+        {
+            std::lock_guard<std::mutex> lock(m_injectMutex);
+            Job* job = AllocateJob(threadIndex);
+            *job     = { function, context, begin, end, &counter, nullptr, job->OwnerIndex };
+            m_injectedJobs.push_back(job);
+            m_injectedCount.fetch_add(1, std::memory_order_release);
+        }
+        else
+        {
+            Job* job = AllocateJob(threadIndex);
+            *job     = { function, context, begin, end, &counter, nullptr, job->OwnerIndex };
+            if (!m_deques[threadIndex]->Push(job))
+            {
+                Execute(job, threadIndex); // 덱이 가득 찼으면 바로 실행
+                return;
+            }
+        }
+
+        // 잠든 작업 스레드가 있으면 하나만 깨움 (깨어난 스레드가 작업을 나누어 넣으면서 다른 스레드를 이어서 깨움)
+        // 세대 증가와 잠든 수 확인은 작업 스레드의 (잠든 수 증가 → 세대 확인) 과 순서가 맞물려야 하므로 seq_cst
+        m_workGeneration.fetch_add(1, std::memory_order_seq_cst);
+        if (m_sleepingCount.load(std::memory_order_seq_cst) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_wakeCondition.notify_one();
+        }
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        const uint32 threadIndex = GetCurrentThreadIndex();
+        while (!counter.IsDone())
+        {
+            if (Job* job = FindJob(threadIndex))
+            {
+                Execute(job, threadIndex);
+            }
+            else
+            {
+                std::this_thread::yield(); // 남은 작업은 이미 다른 스레드가 실행 중
+            }
+        }
+    }
+
+    void JobSystem::ParallelFor(uint32 count, uint32 grainSize, JobFunction function, void* context)
+    {
+        if (count == 0)
+            return;
+
+        if (grainSize == 0)
+        {
+            grainSize = std::max(1u, count / (GetThreadCount() * 8)); // 스레드당 구간 8 개 (늦게 끝나는 구간이 있어도 남은 구간을 나누어 가져가도록)
+        }
+
+        // 작업 스레드가 없거나 구간이 하나뿐이면 현재 스레드에서 바로 실행
+        if (m_workers.empty() || count <= grainSize)
+        {
+            function(context, 0, count);
+            return;
+        }
+
+        JobCounter         counter;
+        ParallelForContext parallelFor{ this, function, context, grainSize, &counter };
+        RunParallelForRange(&parallelFor, 0, count);
+        Wait(counter);
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Private
+    //////////////////////////////////////////////////////////////
+
+    void JobSystem::WorkerMain(uint32 threadIndex)
+    {
+        t_threadBinding = { this, threadIndex };
+
+        uint32 idleCount = 0;
+        while (true)
+        {
+            // 작업을 찾기 전에 세대를 읽어 둠 (찾지 못한 뒤에 추가된 작업은 세대가 달라지므로 잠들지 않음)
+            const uint32 generation = m_workGeneration.load(std::memory_order_seq_cst);
+            if (Job* job = FindJob(threadIndex))
+            {
+                Execute(job, threadIndex);
+                idleCount = 0;
+                continue;
+            }
+
+            if (m_isStopping.load(std::memory_order_relaxed))
+                return;
+
+            if (++idleCount < IdleSpinCount)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            idleCount = 0;
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingCount.fetch_add(1, std::memory_order_seq_cst);
+            m_wakeCondition.wait(lock, [&] { return m_isStopping.load() || m_workGeneration.load(std::memory_order_seq_cst) != generation; });
+            m_sleepingCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    JobSystem::Job* JobSystem::FindJob(uint32 threadIndex)
+    {
+        // 1. 자기 덱 (가장 최근에 넣은 작업, 캐시에 남아 있을 가능성이 높음)
+        if (threadIndex != InvalidThreadIndex)
+        {
+            if (Job* job = m_deques[threadIndex]->Pop())
+                return job;
+        }
+
+        // 2. 등록되지 않은 스레드가 넣은 작업
+        if (m_injectedCount.load(std::memory_order_acquire) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_injectMutex);
+            if (!m_injectedJobs.empty())
+            {
+                Job* job = m_injectedJobs.front();
+                m_injectedJobs.pop_front();
+                m_injectedCount.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        // 3. 다른 스레드의 덱 (스레드마다 다른 덱부터 시작하여 같은 덱에 몰리지 않도록)
+        const uint32 dequeCount = static_cast<uint32>(m_deques.size());
+        const uint32 start      = NextStealRandom() % dequeCount;
+        for (uint32 i = 0; i < dequeCount; i++)
+        {
+            const uint32 victim = (start + i) % dequeCount;
+            if (victim == threadIndex)
+                continue;
+
+            if (Job* job = m_deques[victim]->Steal())
+                return job;
+        }
+
+        return nullptr;
+    }
+
+    JobSystem::Job* JobSystem::AllocateJob(uint32 threadIndex)
+    {
+        const uint32 poolIndex = threadIndex == InvalidThreadIndex ? static_cast<uint32>(m_jobPools.size()) - 1 : threadIndex;
+        JobPool&     pool      = *m_jobPools[poolIndex];
+
+        if (pool.FreeJobs == nullptr)
+        {
+            // 다른 스레드가 돌려준 작업을 통째로 가져옴
+            pool.FreeJobs = pool.ReturnedJobs.exchange(nullptr, std::memory_order_acquire);
+        }
+
+        if (pool.FreeJobs == nullptr)
+        {
+            std::unique_ptr<Job[]>& chunk = pool.Chunks.emplace_back(std::make_unique<Job[]>(JobChunkSize));
+            for (uint32 i = 0; i < JobChunkSize; i++)
+            {
+                chunk[i].Next       = i + 1 < JobChunkSize ? &chunk[i + 1] : nullptr;
+                chunk[i].OwnerIndex = poolIndex;
+            }
+            pool.FreeJobs = &chunk[0];
+        }
+
+        Job* job      = pool.FreeJobs;
+        pool.FreeJobs = job->Next;
+        return job;
+    }
+
+    void JobSystem::FreeJob(Job* job, uint32 threadIndex)
+    {
+        JobPool& pool = *m_jobPools[job->OwnerIndex];
+        if (job->OwnerIndex == threadIndex)
+        {
+            job->Next     = pool.FreeJobs;
+            pool.FreeJobs = job;
+            return;
+        }
+
+        Job* head = pool.ReturnedJobs.load(std::memory_order_relaxed);
+        do
+        {
+            job->Next = head;
+        } while (!pool.ReturnedJobs.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void JobSystem::Execute(Job* job, uint32 threadIndex)
+    {
+        const Job executing = *job;
+        FreeJob(job, threadIndex);
+
+        executing.Function(executing.Context, executing.Begin, executing.End);
+
+        // 카운터를 내린 뒤에는 기다리던 스레드가 카운터를 소멸시킬 수 있으므로 더 이상 접근하지 않음
+        executing.Counter->m_pendingCount.fetch_sub(1, std::memory_order_release);
+    }
+
+    void JobSystem::RunParallelForRange(void* context, uint32 begin, uint32 end)
+    {
+        const ParallelForContext& parallelFor = *static_cast<const ParallelForContext*>(context);
+
+        // 뒤쪽 절반을 덱에 넣어 다른 스레드가 훔쳐 가도록 하고, 앞쪽은 계속 나눔
+        while (end - begin > parallelFor.GrainSize)
+        {
+            const uint32 middle = begin + (end - begin) / 2;
+            parallelFor.System->Run(&JobSystem::RunParallelForRange, context, *parallelFor.Counter, middle, end);
+            end = middle;
+        }
+
+        parallelFor.Function(parallelFor.Context, begin, end);
+    }
+} // namespace TDME
\ No newline at end of file
@@ -3,9 +3,12 @@
 #include <Core/Math/Transform.h>
 #include <Core/Math/TMatrix4x4.h>
 
+#include "Engine/Object/Component/ComponentType.h"
 #include "Engine/Object/GameObject.h"
 #include "Engine/Object/ILifecycle.h"
 #include "Engine/Object/IUpdatable.h"
+#include "Engine/Object/ObjectPool.h"
+#include "Engine/World/TickManager.h"
 
 #include <memory>
 #include <vector>
@@ -14,14 +17,20 @@ namespace TDME
 {
     class GActorComponent;
     class GSceneComponent;
+    class Level;
 
     /**
      * @brief Actor 클래스
      * @details 월드에 배치 가능한 게임 오브젝트의 베이스 클래스
+     * @li 컴포넌트는 타입 ID(및 모든 상위 타입 ID)별로 묶어 저장하므로 GetComponent / GetComponents 는 dynamic_cast 없이 조회
+     * @li 컴포넌트는 타입별 오브젝트 풀에서 할당하여 같은 타입끼리 메모리에 모아 둠
+     * @li Update 는 재정의한 Actor / 컴포넌트만 Level 의 TickManager 가 호출 (기본 빈 Update 는 호출되지 않음)
      * @see TDME::GameObject, TDME::ILifecycle, TDME::IUpdatable
      */
     class AActor : public GameObject, public ILifecycle, public IUpdatable
     {
+        TDME_OBJECT_CLASS(AActor, GameObject)
+
     public:
         AActor();
         ~AActor() override;
@@ -34,23 +43,94 @@ namespace TDME
         void Update(float deltaTime) override { (void)deltaTime; }
         void EndPlay() override {}
 
+        //////////////////////////////////////////////////////////////
+        // Tick
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Tick(Update 호출) 활성화 여부 설정
+         * @details 비활성화하면 TickManager 의 목록에서 빠지므로 순회 비용도 없음 (O(1))
+         * @param enabled 활성화 여부
+         */
+        void SetTickEnabled(bool enabled);
+
+        /**
+         * @brief Tick 활성화 여부 반환
+         */
+        [[nodiscard]] bool IsTickEnabled() const { return m_tick.IsEnabled; }
+
+        /**
+         * @brief Tick 간격 설정
+         * @details 간격이 있으면 경과 시간이 간격을 넘을 때마다 누적된 시간으로 Update 호출
+         * @param interval Tick 간격 (초, 0 이하면 매 프레임)
+         */
+        void SetTickInterval(float interval);
+
+        /**
+         * @brief Tick 간격 반환 (초, 0 이면 매 프레임)
+         */
+        [[nodiscard]] float GetTickInterval() const { return m_tick.Interval; }
+
+        /**
+         * @brief Tick 그룹 설정 (그룹은 ETickGroup 순서대로 실행)
+         * @param group Tick 그룹
+         */
+        void SetTickGroup(ETickGroup group);
+
+        /**
+         * @brief Tick 그룹 반환 (사용자 설정 값, 선행 조건 때문에 더 늦은 그룹에서 실행될 수 있음)
+         */
+        [[nodiscard]] ETickGroup GetTickGroup() const { return m_tick.Group; }
+
+        /**
+         * @brief 작업 스레드에서 병렬로 Tick 할지 설정
+         * @details Update 에서 자신과 자신의 컴포넌트 상태(로컬 트랜스폼 포함)만 바꾸는 Actor 만 허용할 것.
+         *          스폰 / 삭제 / 부착 / 분리는 Level::GetCommandBuffer 에 기록하고, World Matrix 읽기나 Tick 설정 변경이 필요하면 메인 스레드에서 Tick
+         * @param isParallel 병렬 Tick 여부 (기본값 false)
+         */
+        void SetTickInParallel(bool isParallel);
+
+        /**
+         * @brief 병렬 Tick 여부 반환
+         */
+        [[nodiscard]] bool IsTickInParallel() const { return m_tick.IsParallel; }
+
+        /**
+         * @brief 선행 조건 추가 (prerequisite 의 Update 가 끝난 뒤에 이 Actor 의 Update 호출)
+         * @details 선행 조건이 다른 그룹에 있으면 더 늦은 그룹에서, 같은 그룹이면 그 다음 단계에서 실행.
+         *          어느 한쪽이 삭제되면 연결이 자동으로 끊김
+         * @note 연결은 Level 의 TickManager 가 보관하므로 같은 Level 에 스폰된 Actor 끼리만 연결됨 (생성자에서 호출하면 무시, BeginPlay 이후에 호출할 것)
+         * @param prerequisite 먼저 Update 할 Actor
+         */
+        void AddTickPrerequisite(AActor* prerequisite);
+
+        /**
+         * @brief 선행 조건 제거
+         * @param prerequisite 제거할 선행 조건 Actor
+         */
+        void RemoveTickPrerequisite(AActor* prerequisite);
+
         //////////////////////////////////////////////////////////////
         // 컴포넌트 관리
         //////////////////////////////////////////////////////////////
 
         /**
          * @brief 컴포넌트 추가
-         * @tparam T 컴포넌트 타입 (GActorComponent를 상속받은 클래스)
+         * @tparam T 컴포넌트 타입 (GActorComponent를 상속받고 TDME_COMPONENT_TYPE 을 선언한 클래스)
          * @return T* 추가된 컴포넌트 포인터
          */
         template <typename T>
         T* AddComponent(bool isRoot = false)
         {
             static_assert(std::is_base_of_v<GActorComponent, T>, "T must derive from GActorComponent");
-            auto component = std::make_unique<T>();
+            auto component = MakePooled<T, GActorComponent>(); // 타입별 풀에서 할당
 
-            T* ptr = component.get();
+            T* ptr = static_cast<T*>(component.get());
             ptr->RegisterComponent(this);
+            ptr->m_tick.Function = TickManager::GetTickFunction<T, GActorComponent>(); // Update 를 재정의한 타입만 Tick
+
+            // 자신과 모든 상위 타입 ID 로 등록 (GetComponent<Base> 로 파생 컴포넌트도 찾을 수 있도록)
+            ForEachComponentTypeID<T>([this, ptr](ComponentTypeID typeID) { RegisterComponentType(typeID, ptr); });
 
             if constexpr (std::is_base_of_v<GSceneComponent, T>) // T가 GSceneComponent를 상속받고 isRoot가 true인 경우, Root Component로 설정
             {
@@ -59,27 +139,67 @@ namespace TDME
             }
 
             m_components.push_back(std::move(component));
+
+            if (m_level) // 이미 Level 에 스폰된 Actor 면 바로 객체 ID 발급 / 트랜스폼 계층 구조 / Tick 등록
+                RegisterComponentToLevel(ptr);
+
             return ptr;
         }
 
         /**
          * @brief 컴포넌트 찾아서 반환
-         * @tparam T 컴포넌트 타입
-         * @return T* 찾은 컴포넌트 포인터 (없으면 nullptr)
+         * @details 타입별 테이블에서 조회 (컴포넌트 개수와 무관, RTTI 미사용)
+         * @tparam T 컴포넌트 타입 (파생 타입 컴포넌트도 찾음)
+         * @return T* 먼저 추가된 컴포넌트 포인터 (없으면 nullptr)
          */
         template <typename T>
         T* GetComponent() const
         {
-            for (const auto& component : m_components)
-            {
-                if (T* casted = dynamic_cast<T*>(component.get()))
-                {
-                    return casted;
-                }
-            }
-            return nullptr;
+            const ComponentTypeRange* range = FindComponentTypeRange(T::StaticComponentTypeID);
+            return range ? static_cast<T*>(m_componentsByType[range->Begin]) : nullptr;
         }
 
+        /**
+         * @brief 특정 타입(및 파생 타입) 컴포넌트 목록 반환
+         * @details 할당 없이 타입별 배열을 그대로 참조하는 뷰 (추가된 순서)
+         * @tparam T 컴포넌트 타입
+         * @return ComponentView<T> 컴포넌트 뷰 (컴포넌트를 추가하면 무효화)
+         */
+        template <typename T>
+        ComponentView<T> GetComponents() const
+        {
+            const ComponentTypeRange* range = FindComponentTypeRange(T::StaticComponentTypeID);
+            return range ? ComponentView<T>(m_componentsByType.data() + range->Begin, range->Count) : ComponentView<T>();
+        }
+
+        //////////////////////////////////////////////////////////////
+        // Level 등록
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Actor 를 Level 에 등록 (Level::SpawnActor 에서 BeginPlay 전에 호출)
+         * @details 자신과 보유한 컴포넌트의 객체 ID 를 발급하고, SceneComponent 를 Level 의 TransformHierarchy 에,
+         *          Update 를 재정의한 Actor / 컴포넌트를 Level 의 TickManager 에 등록
+         * @param level 소속 Level
+         */
+        void RegisterToLevel(Level* level);
+
+        /**
+         * @brief Actor 를 Level 에서 등록 해제 (Level 이 Actor 를 삭제하기 직전에 호출)
+         * @details 자신과 보유한 컴포넌트의 객체 ID 를 무효화하여 이 Actor 를 가리키던 핸들이 nullptr 로 조회되도록 하고, Tick 목록에서 제거
+         */
+        void UnregisterFromLevel();
+
+        /**
+         * @brief 소속 Level 반환 (스폰 전이면 nullptr)
+         */
+        [[nodiscard]] Level* GetLevel() const { return m_level; }
+
+        /**
+         * @brief 삭제 예약 여부 반환 (Level::DestroyActor 이후 실제 삭제 전까지 true)
+         */
+        [[nodiscard]] bool IsPendingDestroy() const { return m_isPendingDestroy; }
+
         //////////////////////////////////////////////////////////////
         // Getter / Setter
         //////////////////////////////////////////////////////////////
@@ -105,11 +225,61 @@ namespace TDME
          * @brief World Matrix 반환
          * @details Root Component의 World Matrix를 반환
          */
-        [[nodiscard]] const Matrix& GetWorldMatrix() const;
+        [[nodiscard]] Matrix GetWorldMatrix() const;
 
     protected:
-        GSceneComponent*                              m_rootComponent = nullptr;
-        std::vector<std::unique_ptr<GActorComponent>> m_components;
+        GSceneComponent*                          m_rootComponent = nullptr;
+        std::vector<TPooledPtr<GActorComponent>> m_components;
+
+    private:
+        /**
+         * @brief 타입 ID 하나에 해당하는 컴포넌트 구간 (m_componentsByType 의 [Begin, Begin + Count))
+         */
+        struct ComponentTypeRange
+        {
+            ComponentTypeID TypeID;
+            uint32          Begin;
+            uint32          Count;
+        };
+
+        /**
+         * @brief 컴포넌트를 소속 Level 에 등록 (객체 ID 발급, Tick 등록, SceneComponent 면 TransformHierarchy 에 등록)
+         */
+        void RegisterComponentToLevel(GActorComponent* component);
+
+        /**
+         * @brief 타입별 테이블에 컴포넌트 추가 (해당 타입 구간의 끝에 삽입)
+         * @param typeID 타입 ID
+         * @param component 컴포넌트
+         */
+        void RegisterComponentType(ComponentTypeID typeID, GActorComponent* component);
+
+        /**
+         * @brief 타입 ID 의 컴포넌트 구간 반환 (TypeID 오름차순 정렬된 작은 배열에서 이진 탐색)
+         * @return const ComponentTypeRange* 없으면 nullptr
+         */
+        const ComponentTypeRange* FindComponentTypeRange(ComponentTypeID typeID) const;
+
+        /**
+         * @brief Tick 설정 변경을 소속 Level 의 TickManager 에 반영
+         */
+        void RefreshTick();
+
+        friend class Level;
+
+        static constexpr uint32 InvalidLevelIndex = ~0u;
+
+        // Level 이 관리하는 상태 (삭제 시 목록을 탐색하지 않고 인덱스로 바로 제거하기 위함)
+        Level* m_level            = nullptr;
+        uint32 m_levelIndex       = InvalidLevelIndex; // Level::m_actors 내 인덱스
+        uint32 m_renderableIndex  = InvalidLevelIndex; // Level::m_renderables 내 인덱스 (렌더링 불가능하면 InvalidLevelIndex)
+        bool   m_isPendingDestroy = false;             // 삭제 예약 중복 방지 플래그
+
+        TickState m_tick; // Tick 설정과 TickManager 의 레코드 인덱스
+
+        // 타입별 컴포넌트 테이블 (같은 타입 ID 의 컴포넌트가 연속으로 놓이도록 정렬)
+        std::vector<ComponentTypeRange> m_componentTypeRanges; // TypeID 오름차순
+        std::vector<GActorComponent*>   m_componentsByType;
 
     }; // class AActor
 } // namespace TDME
\ No newline at end of file
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/String/Name.h>
+
+#include <atomic>
+
+/**
+ * @brief 최상위 오브젝트 클래스(GameObject)의 클래스 정보 선언
+ */
+#define TDME_OBJECT_ROOT_CLASS(ThisClass)                                                      \
+public:                                                                                        \
+    using ThisObjectClass  = ThisClass;                                                        \
+    using SuperObjectClass = void;                                                             \
+    static const ::TDME::ClassInfo& StaticClass() { return s_classInfo; }                      \
+    [[nodiscard]] virtual const ::TDME::ClassInfo& GetClass() const { return s_classInfo; }    \
+                                                                                               \
+private:                                                                                       \
+    static inline const ::TDME::ClassInfo s_classInfo{ #ThisClass, nullptr };                  \
+                                                                                               \
+public:
+
+/**
+ * @brief 오브젝트 클래스의 클래스 정보 선언 (클래스 본문 맨 앞에 작성)
+ * @details 클래스마다 정적 ClassInfo 를 하나 두고 프로그램 시작 시 레지스트리에 등록하여 IsA / Cast 가 RTTI 없이 동작하도록 함
+ * @note 선언하지 않은 파생 클래스는 상위 클래스와 같은 클래스로 취급되며, Cast / IsA 의 대상 타입으로 사용할 수 없음
+ * @code
+ * class APlanet : public AActor, public IRenderable
+ * {
+ *     TDME_OBJECT_CLASS(APlanet, AActor)
+ *     ...
+ * };
+ * @endcode
+ */
+#define TDME_OBJECT_CLASS(ThisClass, SuperClass)                                                 \
+public:                                                                                          \
+    using ThisObjectClass  = ThisClass;                                                          \
+    using SuperObjectClass = SuperClass;                                                         \
+    static const ::TDME::ClassInfo& StaticClass() { return s_classInfo; }                        \
+    [[nodiscard]] const ::TDME::ClassInfo& GetClass() const override { return s_classInfo; }     \
+                                                                                                 \
+private:                                                                                         \
+    static inline const ::TDME::ClassInfo s_classInfo{ #ThisClass, &SuperClass::StaticClass };  \
+                                                                                                 \
+public:
+
+namespace TDME
+{
+    /**
+     * @brief 오브젝트 클래스 정보
+     * @details TDME_OBJECT_CLASS 로 선언된 모든 GameObject 파생 클래스의 상속 트리를 전위 순회 번호로 관리.
+     * @li 각 클래스는 전위 순회 번호(클래스 인덱스)와 서브트리 크기를 가지며, 파생 클래스는 항상 [인덱스, 인덱스 + 서브트리 크기) 구간에 들어감
+     * @li 따라서 IsChildOf 는 상속 깊이와 무관하게 뺄셈 / 비교 한 번으로 판정 (dynamic_cast 의 상속 트리 탐색 / 문자열 비교 없음)
+     * @li 레지스트리는 정적 초기화 중 등록만 하고, 번호는 World 생성 시 BuildRegistry 에서 한 번 계산
+     * @note World 없이 조회하면 첫 조회 시 계산 (여러 스레드에서 동시에 처음 조회해도 한 스레드만 계산하고 나머지는 완료를 기다림)
+     * @see TDME::GameObject
+     */
+    class ClassInfo
+    {
+    public:
+        using SuperClassGetter = const ClassInfo& (*)();
+
+        /**
+         * @brief 클래스 정보 생성 및 레지스트리 등록 (TDME_OBJECT_CLASS 에서만 사용)
+         * @param name 클래스 이름
+         * @param superClassGetter 상위 클래스 정보 반환 함수 (최상위 클래스면 nullptr)
+         */
+        ClassInfo(const char* name, SuperClassGetter superClassGetter);
+
+        ClassInfo(const ClassInfo&)            = delete;
+        ClassInfo& operator=(const ClassInfo&) = delete;
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 클래스 이름 반환
+         */
+        [[nodiscard]] const char* GetName() const { return m_name; }
+
+        /**
+         * @brief 클래스 타입 ID 반환 (클래스 이름의 해시, 실행마다 동일)
+         */
+        [[nodiscard]] NameHash GetTypeID() const { return m_typeID; }
+
+        /**
+         * @brief 상위 클래스 정보 반환 (최상위 클래스면 nullptr)
+         */
+        [[nodiscard]] const ClassInfo* GetSuperClass() const;
+
+        /**
+         * @brief 클래스 인덱스 반환 (상속 트리 전위 순회 번호, 레지스트리 구성에 따라 달라지므로 저장하지 말 것)
+         */
+        [[nodiscard]] uint32 GetClassIndex() const;
+
+        /**
+         * @brief 자신을 포함한 파생 클래스 수 반환
+         */
+        [[nodiscard]] uint32 GetSubtreeSize() const;
+
+        /**
+         * @brief 이 클래스가 base 이거나 base 의 파생 클래스인지 여부 (O(1))
+         * @param base 상위 클래스 정보
+         */
+        [[nodiscard]] FORCE_INLINE bool IsChildOf(const ClassInfo& base) const
+        {
+            if (s_isRegistryDirty.load(std::memory_order_acquire))
+            {
+                BuildRegistry();
+            }
+
+            // 부호 없는 뺄셈으로 index < base 인 경우도 한 번의 비교로 걸러냄
+            return m_classIndex - base.m_classIndex < base.m_subtreeSize;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 레지스트리
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 등록된 클래스의 상속 트리를 전위 순회하여 클래스 인덱스 / 서브트리 크기 계산
+         * @details 새 클래스가 등록된 경우에만 다시 계산 (이미 최신이면 아무것도 하지 않음). 스레드 안전
+         */
+        static void BuildRegistry();
+
+        /**
+         * @brief 등록된 클래스 수 반환
+         */
+        [[nodiscard]] static uint32 GetClassCount() { return s_classCount; }
+
+    private:
+        static constexpr uint32 InvalidIndex = ~0u;
+
+        const char*      m_name;
+        NameHash         m_typeID;
+        SuperClassGetter m_superClassGetter;
+        const ClassInfo* m_superClass     = nullptr;
+        ClassInfo*       m_nextRegistered = nullptr;      // 등록 목록 (침습형 단일 연결 리스트)
+        uint32           m_classIndex     = InvalidIndex; // 전위 순회 번호 (레지스트리 구성 전에는 어떤 구간에도 속하지 않음)
+        uint32           m_subtreeSize    = 0;            // 자신을 포함한 파생 클래스 수
+        bool             m_isRegistered   = false;        // 정적 초기화 순서와 무관하게 생성 여부 확인 (정적 저장소는 0 으로 초기화됨)
+
+        // 정적 초기화 순서에 의존하지 않도록 모두 상수 초기화
+        static ClassInfo*        s_registeredHead;
+        static uint32            s_classCount;
+        static std::atomic<bool> s_isRegistryDirty; // 계산 결과는 false 를 release 로 기록하여 acquire 로 읽은 스레드에 공개
+    };
+} // namespace TDME
\ No newline at end of file
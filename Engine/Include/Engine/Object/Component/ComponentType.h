@@ -0,0 +1,113 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/String/Name.h>
+
+#include "Engine/Object/ClassInfo.h"
+
+#include <type_traits>
+
+/**
+ * @brief 컴포넌트 클래스의 타입 정보 선언 (클래스 본문의 public 영역에 작성)
+ * @details 컴파일 타임 타입 ID 와 상위 클래스를 선언하여 AActor::GetComponent<T> 가 dynamic_cast 없이 타입별 테이블을 조회하도록 함.
+ *          오브젝트 클래스 정보(TDME_OBJECT_CLASS)도 함께 선언하므로 IsA / Cast 를 그대로 사용할 수 있음
+ * @code
+ * class GCameraComponent : public GSceneComponent
+ * {
+ * public:
+ *     TDME_COMPONENT_TYPE(GCameraComponent, GSceneComponent)
+ *     ...
+ * };
+ * @endcode
+ */
+#define TDME_COMPONENT_TYPE(ThisClass, SuperClass)      \
+    TDME_OBJECT_CLASS(ThisClass, SuperClass)            \
+    TDME_COMPONENT_TYPE_ID(ThisClass, SuperClass)
+
+/**
+ * @brief 최상위 컴포넌트 클래스(GActorComponent)의 타입 정보 선언
+ * @param SuperClass 오브젝트 클래스 계층의 상위 클래스 (컴포넌트 타입 계층은 여기서 끝남)
+ */
+#define TDME_COMPONENT_ROOT_TYPE(ThisClass, SuperClass) \
+    TDME_OBJECT_CLASS(ThisClass, SuperClass)            \
+    using RootComponentClass = ThisClass;               \
+    TDME_COMPONENT_TYPE_ID(ThisClass, void)
+
+/**
+ * @brief 컴포넌트 타입 ID 선언 (TDME_COMPONENT_TYPE / TDME_COMPONENT_ROOT_TYPE 내부용)
+ */
+#define TDME_COMPONENT_TYPE_ID(ThisClass, SuperClass)                                       \
+    using ThisComponentClass                                      = ThisClass;              \
+    using SuperComponentClass                                     = SuperClass;             \
+    static constexpr ::TDME::ComponentTypeID StaticComponentTypeID = ::TDME::HashName(#ThisClass);
+
+namespace TDME
+{
+    /**
+     * @brief 컴포넌트 타입 ID (클래스 이름의 컴파일 타임 해시, ClassInfo::GetTypeID 와 같은 값)
+     * @note 클래스 이름(네임스페이스 제외)만 해시하므로 ClassInfo::BuildRegistry 에서 모든 클래스의 타입 ID 가 서로 다른지 검사 (디버그 빌드)
+     */
+    using ComponentTypeID = NameHash;
+
+    /**
+     * @brief 타입 T 와 모든 상위 컴포넌트 타입의 ID 를 자식 -> 부모 순으로 전달 (RTTI 없이 상속 관계 매칭에 사용)
+     * @tparam T TDME_COMPONENT_TYPE 을 선언한 컴포넌트 타입
+     * @param func ComponentTypeID 를 인자로 받는 함수
+     */
+    template <typename T, typename Func>
+    constexpr void ForEachComponentTypeID(Func&& func)
+    {
+        static_assert(std::is_same_v<typename T::ThisComponentClass, T>, "T must declare TDME_COMPONENT_TYPE");
+
+        func(T::StaticComponentTypeID);
+        if constexpr (!std::is_void_v<typename T::SuperComponentClass>)
+        {
+            ForEachComponentTypeID<typename T::SuperComponentClass>(func);
+        }
+    }
+
+    /**
+     * @brief 특정 타입(및 파생 타입) 컴포넌트 목록 뷰 (할당 없음, AActor 의 타입별 배열을 그대로 참조)
+     * @tparam T 컴포넌트 타입
+     * @note Actor 에 컴포넌트를 추가하면 무효화됨
+     */
+    template <typename T>
+    class ComponentView
+    {
+    public:
+        using RootClass = typename T::RootComponentClass;
+
+        class Iterator
+        {
+        public:
+            explicit Iterator(RootClass* const* current) : m_current(current) {}
+
+            T*        operator*() const { return static_cast<T*>(*m_current); }
+            Iterator& operator++()
+            {
+                ++m_current;
+                return *this;
+            }
+            bool operator!=(const Iterator& other) const { return m_current != other.m_current; }
+
+        private:
+            RootClass* const* m_current;
+        };
+
+        ComponentView() = default;
+        ComponentView(RootClass* const* data, uint32 count)
+            : m_begin(data), m_end(data + count) {}
+
+        Iterator begin() const { return Iterator(m_begin); }
+        Iterator end() const { return Iterator(m_end); }
+
+        [[nodiscard]] uint32 size() const { return static_cast<uint32>(m_end - m_begin); }
+        [[nodiscard]] bool   empty() const { return m_begin == m_end; }
+
+        T* operator[](uint32 index) const { return static_cast<T*>(m_begin[index]); }
+
+    private:
+        RootClass* const* m_begin = nullptr;
+        RootClass* const* m_end   = nullptr;
+    };
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+namespace TDME
+{
+    /**
+     * @brief SceneComponent 의 이동성
+     * @details TransformHierarchy 가 매 프레임 갱신할 노드를 고르는 기준
+     * @see TDME::GSceneComponent::SetMobility
+     */
+    enum class EComponentMobility : uint8
+    {
+        Static,     /** 배치 후 움직이지 않음. 자신과 모든 조상이 Static 이면 World Matrix 를 한 번만 계산(Bake)하고 매 프레임 갱신에서 제외 */
+        Stationary, /** 거의 움직이지 않음. 매 프레임 갱신에는 포함되지만 변경이 없으면 버전 비교만 수행하고, 렌더러의 정적 배치에서는 제외 */
+        Movable,    /** 자유롭게 움직임 - 기본 값 */
+    };
+} // namespace TDME
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "Engine/Object/Component/ComponentType.h"
 #include "Engine/Object/GameObject.h"
 #include "Engine/Object/ILifecycle.h"
 #include "Engine/Object/IUpdatable.h"
+#include "Engine/World/TickManager.h"
 
 namespace TDME
 {
@@ -11,6 +13,8 @@ namespace TDME
     class GActorComponent : public GameObject, public ILifecycle, public IUpdatable
     {
     public:
+        TDME_COMPONENT_ROOT_TYPE(GActorComponent, GameObject)
+
         GActorComponent();
         ~GActorComponent() override;
 
@@ -19,9 +23,57 @@ namespace TDME
         //////////////////////////////////////////////////////////////
 
         void BeginPlay() override {}
-        void Update(float deltaTime) override { (void)deltaTime; }
+        void Update(float deltaTime) override { (void)deltaTime; } // 재정의한 컴포넌트만 소유 Actor 의 Level 에서 Tick
         void EndPlay() override {}
 
+        //////////////////////////////////////////////////////////////
+        // Tick
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Tick(Update 호출) 활성화 여부 설정 (O(1))
+         * @param enabled 활성화 여부
+         */
+        void SetTickEnabled(bool enabled);
+
+        /**
+         * @brief Tick 활성화 여부 반환
+         */
+        [[nodiscard]] bool IsTickEnabled() const { return m_tick.IsEnabled; }
+
+        /**
+         * @brief Tick 간격 설정
+         * @param interval Tick 간격 (초, 0 이하면 매 프레임)
+         */
+        void SetTickInterval(float interval);
+
+        /**
+         * @brief Tick 간격 반환 (초, 0 이면 매 프레임)
+         */
+        [[nodiscard]] float GetTickInterval() const { return m_tick.Interval; }
+
+        /**
+         * @brief Tick 그룹 설정
+         * @param group Tick 그룹
+         */
+        void SetTickGroup(ETickGroup group);
+
+        /**
+         * @brief Tick 그룹 반환
+         */
+        [[nodiscard]] ETickGroup GetTickGroup() const { return m_tick.Group; }
+
+        /**
+         * @brief 작업 스레드에서 병렬로 Tick 할지 설정 (자신의 상태만 바꾸는 컴포넌트만 허용, AActor::SetTickInParallel 참고)
+         * @param isParallel 병렬 Tick 여부 (기본값 false)
+         */
+        void SetTickInParallel(bool isParallel);
+
+        /**
+         * @brief 병렬 Tick 여부 반환
+         */
+        [[nodiscard]] bool IsTickInParallel() const { return m_tick.IsParallel; }
+
         //////////////////////////////////////////////////////////////
         // 컴포넌트 관리
         //////////////////////////////////////////////////////////////
@@ -62,5 +114,15 @@ namespace TDME
     protected:
         AActor* m_owner    = nullptr;
         bool    m_isActive = true;
+
+    private:
+        friend class AActor; // AddComponent 에서 실제 타입의 Tick 함수 설정, Level 등록 시 Tick 등록
+
+        /**
+         * @brief 설정 변경을 소속 Level 의 TickManager 에 반영
+         */
+        void RefreshTick();
+
+        TickState m_tick;
     };
 } // namespace TDME
\ No newline at end of file
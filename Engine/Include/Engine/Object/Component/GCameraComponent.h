@@ -16,6 +16,8 @@ namespace TDME
     class GCameraComponent : public GSceneComponent
     {
     public:
+        TDME_COMPONENT_TYPE(GCameraComponent, GSceneComponent)
+
         GCameraComponent();
         ~GCameraComponent() override = default;
 
@@ -66,21 +68,24 @@ namespace TDME
         /**
          * @brief 뷰 행렬 반환
          * @details WorldMatrix의 역행렬 = View 행렬
-         * @return Matrix 뷰 행렬
+         * @note 트랜스폼이 변경되었을 때만 다시 계산 (카메라 World Matrix 는 아핀 행렬이므로 InverseAffine 사용)
+         * @return const Matrix& 뷰 행렬
          */
-        [[nodiscard]] Matrix GetViewMatrix() const
-        {
-            return GetWorldMatrix().Inverse();
-        }
+        [[nodiscard]] const Matrix& GetViewMatrix() const;
 
         /**
          * @brief 투영 행렬 반환
-         * @return Matrix 투영 행렬
+         * @note 투영 파라미터가 변경되었을 때만 다시 계산
+         * @return const Matrix& 투영 행렬
          */
-        [[nodiscard]] Matrix GetProjectionMatrix() const
-        {
-            return PerspectiveFovLH(m_fovY, m_aspectRatio, m_nearZ, m_farZ);
-        }
+        [[nodiscard]] const Matrix& GetProjectionMatrix() const;
+
+        /**
+         * @brief 뷰 * 투영 행렬 반환
+         * @note 뷰 또는 투영 행렬이 변경되었을 때만 다시 계산
+         * @return const Matrix& 뷰 * 투영 행렬
+         */
+        [[nodiscard]] const Matrix& GetViewProjectionMatrix() const;
 
         //////////////////////////////////////////////////////////////
         // Getter/Setter
@@ -99,6 +104,9 @@ namespace TDME
             m_aspectRatio = aspectRatio;
             m_nearZ       = nearZ;
             m_farZ        = farZ;
+
+            m_isProjectionDirty     = true;
+            m_isViewProjectionDirty = true;
         }
 
     private:
@@ -106,6 +114,17 @@ namespace TDME
         float m_aspectRatio = 16.0f / 9.0f;    // 화면 비율 (16:9)
         float m_nearZ       = 1.0f;            // 근거리
         float m_farZ        = 1000.0f;         // 원거리
+
+        mutable Matrix m_cachedView           = Matrix::Identity();
+        mutable Matrix m_cachedProjection     = Matrix::Identity();
+        mutable Matrix m_cachedViewProjection = Matrix::Identity();
+
+        // View 는 World 버전으로 무효화 판단 (트랜스폼 변경 알림을 받지 않음)
+        mutable uint32 m_cachedViewWorldVersion     = 0; // m_cachedView 계산 시점의 World 버전 (0 = 아직 계산되지 않음)
+        mutable uint32 m_cachedViewProjWorldVersion = 0; // m_cachedViewProjection 계산 시점의 World 버전
+
+        mutable bool m_isProjectionDirty     = true;
+        mutable bool m_isViewProjectionDirty = true;
     };
 
 } // namespace TDME
\ No newline at end of file
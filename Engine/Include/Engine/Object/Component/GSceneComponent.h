@@ -1,22 +1,69 @@
 #pragma once
 
+#include <Core/Math/TMatrix3x4.h>
 #include <Core/Math/TMatrix4x4.h>
 #include <Core/Math/TVector3.h>
 #include <Core/Math/Transform.h>
 
+#include "Engine/Object/Component/EComponentMobility.h"
 #include "Engine/Object/Component/GActorComponent.h"
 #include <vector>
 
 namespace TDME
 {
+    class TransformHierarchy;
+
     /**
      * @brief SceneComponent 클래스
      * @details Scene에 배치 가능한 (Transform 계층 구조를 가지는) 컴포넌트
-     * @see TDME::GActorComponent
+     * @li Level 에 등록되면 World Matrix 는 TransformHierarchy 가 매 프레임 일괄 계산하고 GetWorldMatrix 는 O(1) 로 읽기만 함
+     * @li 등록되지 않은 컴포넌트(예: 독립 카메라)는 버전 기반 지연 계산을 사용
+     * @li 버전 스탬프: 로컬 트랜스폼이 바뀌면 로컬 버전만 올리고(O(1)), 읽을 때 캐시 계산 시점의 (로컬 버전, 부모 World 버전)과
+     *     비교하여 오래된 캐시만 재계산. 자손에게 Dirty Flag 를 재귀적으로 전파하지 않음
+     * @li 자식 목록은 침습형 연결 리스트(첫 자식 / 이전·다음 형제)로 관리하여 부착/분리가 O(1) 이고 노드마다 별도 힙 할당이 없음
+     * @li 이동성(Mobility)이 Static 인 서브트리는 World Matrix 를 한 번만 계산(Bake)하고 매 프레임 갱신에서 제외
+     * @see TDME::GActorComponent, TDME::TransformHierarchy
      */
     class GSceneComponent : public GActorComponent
     {
     public:
+        TDME_COMPONENT_TYPE(GSceneComponent, GActorComponent)
+
+        /**
+         * @brief 자식 컴포넌트 순회 범위 (형제 링크를 따라가는 range-for 용 뷰, 할당 없음)
+         * @code
+         * for (GSceneComponent* child : component->GetChildrenComponents()) { ... }
+         * @endcode
+         */
+        class ChildRange
+        {
+        public:
+            class Iterator
+            {
+            public:
+                explicit Iterator(GSceneComponent* node) : m_node(node) {}
+
+                GSceneComponent* operator*() const { return m_node; }
+                Iterator&        operator++()
+                {
+                    m_node = m_node->m_nextSibling;
+                    return *this;
+                }
+                bool operator!=(const Iterator& other) const { return m_node != other.m_node; }
+
+            private:
+                GSceneComponent* m_node;
+            };
+
+            explicit ChildRange(GSceneComponent* first) : m_first(first) {}
+
+            Iterator begin() const { return Iterator(m_first); }
+            Iterator end() const { return Iterator(nullptr); }
+
+        private:
+            GSceneComponent* m_first;
+        };
+
         GSceneComponent();
         ~GSceneComponent() override;
 
@@ -25,13 +72,13 @@ namespace TDME
         //////////////////////////////////////////////////////////////
 
         /**
-         * @brief 컴포넌트를 다른 컴포넌트에 부착
+         * @brief 컴포넌트를 다른 컴포넌트에 부착 (부모의 마지막 자식으로 추가, O(1))
          * @param parent 부모 컴포넌트
          */
         void AttachToComponent(GSceneComponent* parent);
 
         /**
-         * @brief 컴포넌트를 부모 컴포넌트에서 분리
+         * @brief 컴포넌트를 부모 컴포넌트에서 분리 (O(1))
          */
         void DetachFromParent();
 
@@ -45,9 +92,47 @@ namespace TDME
         [[nodiscard]] GSceneComponent* GetParentComponent() const { return m_parent; }
 
         /**
-         * @brief 자식 컴포넌트 목록 반환
+         * @brief 자식 컴포넌트 목록 반환 (부착 순서)
+         */
+        [[nodiscard]] ChildRange GetChildrenComponents() const { return ChildRange(m_firstChild); }
+
+        /**
+         * @brief 첫 번째 자식 컴포넌트 반환
+         */
+        [[nodiscard]] GSceneComponent* GetFirstChildComponent() const { return m_firstChild; }
+
+        /**
+         * @brief 마지막 자식 컴포넌트 반환 (O(1))
+         */
+        [[nodiscard]] GSceneComponent* GetLastChildComponent() const { return m_firstChild ? m_firstChild->m_prevSibling : nullptr; }
+
+        /**
+         * @brief 이전 형제 컴포넌트 반환
+         */
+        [[nodiscard]] GSceneComponent* GetPrevSiblingComponent() const { return (m_parent && m_parent->m_firstChild != this) ? m_prevSibling : nullptr; }
+
+        /**
+         * @brief 다음 형제 컴포넌트 반환
          */
-        [[nodiscard]] const std::vector<GSceneComponent*>& GetChildrenComponents() const { return m_children; }
+        [[nodiscard]] GSceneComponent* GetNextSiblingComponent() const { return m_nextSibling; }
+
+        /**
+         * @brief 이동성 반환
+         */
+        [[nodiscard]] EComponentMobility GetMobility() const { return m_mobility; }
+
+        /**
+         * @brief 이동성 설정
+         * @details 계층 구조에 등록되어 있으면 다음 Update 에서 순서를 재구성하여 Bake 대상을 다시 구분.
+         *          Static 은 자신과 모든 조상이 Static 일 때만 Bake 됨 (Movable 부모 아래의 Static 은 Movable 처럼 동작)
+         * @param mobility 이동성
+         */
+        void SetMobility(EComponentMobility mobility);
+
+        /**
+         * @brief World Matrix 가 Bake 되어 매 프레임 갱신에서 제외되는지 여부
+         */
+        [[nodiscard]] bool IsWorldMatrixBaked() const;
 
         /**
          * @brief 트랜스폼 상수(const) 반환 (읽기 전용)
@@ -61,7 +146,8 @@ namespace TDME
         void SetTransform(const Transform& transform);
 
         /**
-         * @brief 트랜스폼 더티 플래그 설정 (부모 컴포넌트의 World Matrix 계산 필요 시 호출)
+         * @brief 로컬 트랜스폼 변경 표시 (O(1))
+         * @details 로컬 버전만 증가시키고, 자손은 읽을 때 부모 World 버전이 달라진 것을 보고 재계산
          */
         void SetTransformDirty();
 
@@ -85,10 +171,26 @@ namespace TDME
 
         /**
          * @brief World Matrix 반환
-         * @details Dirty Flag가 설정되어 있으면 부모 컴포넌트의 World Matrix를 재귀적으로 계산하여 반환
-         * @return const Matrix& 월드 Matrix
+         * @details 캐시가 오래되었으면(로컬 / 부모 World 버전 불일치) 부모 체인을 따라 필요한 부분만 재계산하여 반환.
+         *          TransformHierarchy 의 Update 직후처럼 변경이 없으면 캐시를 바로 반환
+         * @return Matrix 월드 Matrix (캐시된 3x4 아핀 행렬을 4x4 로 변환)
          */
-        [[nodiscard]] const Matrix& GetWorldMatrix() const;
+        [[nodiscard]] Matrix GetWorldMatrix() const;
+
+        /**
+         * @brief World Matrix 반환 (3x4 아핀 행렬)
+         * @details 계층 구조 합성 / GPU 업로드에는 변환 없이 이 값을 그대로 사용
+         * @return const Matrix3x4& 월드 Matrix
+         */
+        [[nodiscard]] const Matrix3x4& GetWorldMatrix3x4() const;
+
+        /**
+         * @brief World Matrix 버전 반환
+         * @details World Matrix 가 재계산될 때마다 증가 (0 = 아직 계산되지 않음).
+         *          World Matrix 에서 파생된 캐시(예: 카메라의 View 행렬)는 이 값을 저장해 두고 비교하여 무효화 여부를 판단
+         * @return uint32 최신 World Matrix 의 버전
+         */
+        [[nodiscard]] uint32 GetWorldVersion() const;
 
         /**
          * @brief World Forward Vector 반환
@@ -111,21 +213,43 @@ namespace TDME
     protected:
         Transform m_transform;
 
-        GSceneComponent*              m_parent = nullptr;
-        std::vector<GSceneComponent*> m_children;
+        // 침습형 자식 링크 (자식 목록을 별도로 할당하지 않음)
+        GSceneComponent* m_parent      = nullptr;
+        GSceneComponent* m_firstChild  = nullptr;
+        GSceneComponent* m_prevSibling = nullptr; // 첫 번째 자식의 m_prevSibling 은 마지막 자식 (원형, O(1) 로 끝에 추가하기 위함)
+        GSceneComponent* m_nextSibling = nullptr; // 마지막 자식이면 nullptr
 
     private:
-        mutable Matrix m_cachedWorldMatrix = Matrix::Identity();
-        mutable bool   m_isDirty           = true;
+        friend class TransformHierarchy;
+
+        TransformHierarchy* m_hierarchy      = nullptr; // 등록된 Level 의 계층 구조 (nullptr 이면 지연 계산)
+        uint32              m_hierarchyIndex = 0;       // 계층 구조 배열 내 인덱스 (순서 재구성 시 갱신)
+        EComponentMobility  m_mobility       = EComponentMobility::Movable;
+
+        // 지연 계산 경로 (계층 구조에 등록되지 않았을 때) 캐시
+        mutable Matrix3x4 m_cachedWorldMatrix   = Matrix3x4::Identity(); // 마지막 열이 항상 (0, 0, 0, 1) 이므로 3x4 로 캐시
+        uint32            m_localVersion        = 1;                     // 로컬 트랜스폼 / 부모 변경 시 증가
+        mutable uint32    m_cachedLocalVersion  = 0;                     // 캐시 계산 시점의 로컬 버전
+        mutable uint32    m_cachedParentVersion = 0;                     // 캐시 계산 시점의 부모 World 버전 (부모가 없으면 0)
+        mutable uint32    m_worldVersion        = 0;                     // 캐시가 재계산될 때마다 증가
+        mutable uint32    m_verifiedEpoch       = 0;                     // 마지막으로 최신임을 확인한 시점의 s_changeEpoch
+
+        static uint32                               s_changeEpoch;  // 어떤 컴포넌트든 트랜스폼이 바뀌면 증가 (이후 읽기에서 재확인 필요)
+        static std::vector<const GSceneComponent*> s_resolveStack; // ResolveWorldMatrix 용 임시 스택
+
+        /**
+         * @brief 부모 World 를 재계산하지 않고 현재 World 버전만 반환
+         */
+        uint32 PeekWorldVersion() const;
 
         /**
-         * @brief 자손 컴포넌트들에 Dirty Flag 를 Top-Down 방식으로 전파
+         * @brief 지연 계산 경로: 부모 체인을 위에서부터 최신 상태로 만듦 (깊은 계층에서도 재귀 없이 스택 사용)
          */
-        void PropagateDirtyFlagToChildren();
+        void ResolveWorldMatrix() const;
 
         /**
-         * @brief World Matrix 재계산
+         * @brief 지연 계산 경로: 부모가 최신이라고 가정하고 자신의 캐시가 오래되었으면 재계산
          */
-        void RecalculateWorldMatrix() const;
+        void UpdateCachedWorldMatrix() const;
     };
 } // namespace TDME
\ No newline at end of file
@@ -2,14 +2,23 @@
 
 #include <Core/CoreTypes.h>
 
+#include "Engine/Object/ClassInfo.h"
+#include "Engine/Object/ObjectHandle.h"
+
+#include <type_traits>
+
 namespace TDME
 {
     /**
      * @brief 게임 오브젝트 클래스
      * @details 게임 오브젝트를 관리하는 클래스.
+     * @li 모든 파생 클래스는 TDME_OBJECT_CLASS 로 클래스 정보를 선언하며, IsA / Cast 로 RTTI 없이 O(1) 타입 검사
+     * @see TDME::ClassInfo
      */
     class GameObject
     {
+        TDME_OBJECT_ROOT_CLASS(GameObject)
+
     public:
         GameObject();
         virtual ~GameObject() = default;
@@ -20,10 +29,11 @@ namespace TDME
 
         /**
          * @brief 객체 ID 반환
-         * @details 객체 ID는 객체가 생성될 때 자동으로 부여되며, 객체가 소멸될 때까지 유지됨
-         * @return uint32 객체 ID
+         * @details Level 에 스폰(컴포넌트는 소유 Actor 가 스폰)될 때 ObjectHandleTable 에서 발급되며, 삭제되면 무효화됨.
+         *          ID 로 ObjectHandleTable::Find 에서 O(1) 조회 가능
+         * @return ObjectID 객체 ID (등록되지 않은 객체면 InvalidObjectID)
          */
-        [[nodiscard]] uint32 GetObjectID() const { return m_objectID; }
+        [[nodiscard]] ObjectID GetObjectID() const { return m_objectID; }
 
         /**
          * @brief 객체 이름 설정
@@ -43,6 +53,21 @@ namespace TDME
          */
         [[nodiscard]] const string& GetName() const { return m_name; }
 
+        //////////////////////////////////////////////////////////////
+        // 타입 검사
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 객체가 T 이거나 T 의 파생 클래스인지 여부 (O(1), RTTI 미사용)
+         * @tparam T TDME_OBJECT_CLASS 를 선언한 GameObject 파생 타입
+         */
+        template <typename T>
+        [[nodiscard]] bool IsA() const
+        {
+            static_assert(std::is_same_v<typename T::ThisObjectClass, T>, "T must declare TDME_OBJECT_CLASS");
+            return GetClass().IsChildOf(T::StaticClass());
+        }
+
         //////////////////////////////////////////////////////////////
         // 복사/이동 금지 (각 객체는 고유 ID를 가지고 있어야 함)
         //////////////////////////////////////////////////////////////
@@ -52,11 +77,35 @@ namespace TDME
         GameObject& operator=(GameObject&&)      = delete;
 
     protected:
-        uint32 m_objectID = 0;
-        string m_name;
+        ObjectID m_objectID = InvalidObjectID;
+        string   m_name;
 
     private:
-        static uint32 s_nextObjectID;
+        friend class ObjectHandleTable;
 
     }; // class GameObject
+
+    /**
+     * @brief GameObject 를 T 로 변환 (dynamic_cast 대체, O(1))
+     * @tparam T TDME_OBJECT_CLASS 를 선언한 GameObject 파생 타입
+     * @param object 변환할 객체 (nullptr 허용)
+     * @return T* object 가 T 이거나 T 의 파생 클래스면 변환된 포인터, 아니면 nullptr
+     * @note 인터페이스(IRenderable 등)로의 변환은 지원하지 않음
+     */
+    template <typename T>
+    [[nodiscard]] T* Cast(GameObject* object)
+    {
+        static_assert(std::is_base_of_v<GameObject, T>, "T must derive from GameObject");
+        return (object && object->IsA<T>()) ? static_cast<T*>(object) : nullptr;
+    }
+
+    /**
+     * @brief GameObject 를 T 로 변환 (const 버전)
+     */
+    template <typename T>
+    [[nodiscard]] const T* Cast(const GameObject* object)
+    {
+        static_assert(std::is_base_of_v<GameObject, T>, "T must derive from GameObject");
+        return (object && object->IsA<T>()) ? static_cast<const T*>(object) : nullptr;
+    }
 } // namespace TDME
\ No newline at end of file
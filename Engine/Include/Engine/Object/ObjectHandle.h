@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Core/CoreMacros.h>
+#include <Core/CoreTypes.h>
+
+#include <type_traits>
+
+namespace TDME
+{
+    /**
+     * @brief 객체 ID (하위 32 비트 = 핸들 테이블 슬롯 인덱스, 상위 32 비트 = 슬롯 세대)
+     * @details 슬롯이 재사용되면 세대가 달라지므로 삭제된 객체의 ID 는 다시 유효해지지 않음
+     */
+    using ObjectID = uint64;
+
+    /**
+     * @brief 유효하지 않은 객체 ID (핸들 테이블에 등록되지 않은 객체)
+     */
+    constexpr ObjectID InvalidObjectID = 0;
+
+    /**
+     * @brief 객체 ID 생성
+     * @param index 슬롯 인덱스
+     * @param generation 슬롯 세대 (0 이 아님)
+     */
+    FORCE_INLINE constexpr ObjectID MakeObjectID(uint32 index, uint32 generation)
+    {
+        return (static_cast<ObjectID>(generation) << 32) | index;
+    }
+
+    /**
+     * @brief 객체 ID 의 슬롯 인덱스 반환
+     */
+    FORCE_INLINE constexpr uint32 GetObjectIndex(ObjectID id) { return static_cast<uint32>(id); }
+
+    /**
+     * @brief 객체 ID 의 슬롯 세대 반환
+     */
+    FORCE_INLINE constexpr uint32 GetObjectGeneration(ObjectID id) { return static_cast<uint32>(id >> 32); }
+
+    /**
+     * @brief 타입이 지정된 객체 핸들 (약한 참조)
+     * @details 객체 ID 만 저장하므로 객체가 삭제되어도 댕글링 포인터가 되지 않음.
+     *          ObjectHandleTable(Level / World) 에서 O(1) 로 포인터를 얻고, 삭제된 객체면 nullptr 을 반환
+     * @tparam T TDME_OBJECT_CLASS 를 선언한 GameObject 파생 타입 (조회할 때 타입을 검사하므로 다른 타입 객체의 ID 로 만든 핸들은 nullptr 로 조회됨)
+     * @code
+     * ObjectHandle<AActor> target(actor);
+     * ...
+     * if (AActor* resolved = GetLevel()->Resolve(target)) { ... }
+     * @endcode
+     * @see TDME::ObjectHandleTable
+     */
+    template <typename T>
+    class ObjectHandle
+    {
+    public:
+        constexpr ObjectHandle() = default;
+        constexpr explicit ObjectHandle(ObjectID id) : m_id(id) {}
+
+        /**
+         * @brief 객체로부터 핸들 생성 (nullptr 이거나 등록되지 않은 객체면 빈 핸들)
+         * @param object 대상 객체
+         */
+        explicit ObjectHandle(const T* object) : m_id(object ? object->GetObjectID() : InvalidObjectID) {}
+
+        /**
+         * @brief 파생 타입 핸들에서 상위 타입 핸들로 변환
+         */
+        template <typename U, typename = std::enable_if_t<std::is_base_of_v<T, U>>>
+        constexpr ObjectHandle(const ObjectHandle<U>& other) : m_id(other.GetID()) {}
+
+        /**
+         * @brief 객체 ID 반환
+         */
+        [[nodiscard]] constexpr ObjectID GetID() const { return m_id; }
+
+        /**
+         * @brief 빈 핸들인지 여부 (객체가 삭제되었는지는 ObjectHandleTable 로 확인)
+         */
+        [[nodiscard]] constexpr bool IsNull() const { return m_id == InvalidObjectID; }
+
+        /**
+         * @brief 핸들 초기화
+         */
+        void Reset() { m_id = InvalidObjectID; }
+
+        constexpr bool operator==(const ObjectHandle& other) const { return m_id == other.m_id; }
+        constexpr bool operator!=(const ObjectHandle& other) const { return m_id != other.m_id; }
+
+    private:
+        ObjectID m_id = InvalidObjectID;
+    };
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace TDME
+{
+    /**
+     * @brief 오브젝트 풀 사용 현황
+     */
+    struct ObjectPoolStats
+    {
+        const char* TypeName;   // 클래스 이름 (TDME_OBJECT_CLASS 를 선언하지 않은 타입은 가장 가까운 상위 클래스 이름)
+        uint32      SlotSize;   // 슬롯 하나의 크기 (바이트)
+        uint32      LiveCount;  // 사용 중인 슬롯 수
+        uint32      SlotCount;  // 할당된 전체 슬롯 수
+        uint32      ChunkCount; // 할당된 청크 수
+
+        /**
+         * @brief 점유율 반환 (0 ~ 1, 슬롯이 없으면 0)
+         */
+        [[nodiscard]] float GetOccupancy() const { return SlotCount ? static_cast<float>(LiveCount) / static_cast<float>(SlotCount) : 0.0f; }
+    };
+
+    /**
+     * @brief 고정 크기 슬롯 오브젝트 풀 (Slab 할당자)
+     * @details 같은 타입의 객체를 청크(슬롯 여러 개를 담은 연속 메모리) 단위로 할당하여 메모리에 모아 둠.
+     * @li 해제된 슬롯은 침습형 Free List 에 넣어 다음 할당에서 재사용 (LIFO, 할당 / 해제 모두 O(1))
+     * @li 청크는 풀이 소멸할 때까지 유지 (빈 슬롯은 OS 에 반환하지 않고 재사용)
+     * @li 모든 풀은 전역 목록에 등록되어 CollectStats 로 타입별 사용 현황을 조회할 수 있음
+     * @note 스레드 안전하지 않음 (Actor / 컴포넌트 생성 / 삭제는 메인 스레드에서 수행)
+     * @see TDME::GetObjectPool, TDME::MakePooled
+     */
+    class ObjectPool
+    {
+    public:
+        /**
+         * @brief 오브젝트 풀 생성 및 전역 목록 등록
+         * @param typeName 타입 이름 (통계 표시용)
+         * @param slotSize 슬롯 크기 (객체 크기)
+         * @param slotAlignment 슬롯 정렬
+         */
+        ObjectPool(const char* typeName, size_t slotSize, size_t slotAlignment);
+        ~ObjectPool();
+
+        ObjectPool(const ObjectPool&)            = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        //////////////////////////////////////////////////////////////
+        // 할당 / 해제
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 슬롯 하나 할당 (생성자는 호출하지 않음)
+         * @details Free List 가 비어 있으면 새 청크를 할당
+         * @return void* 초기화되지 않은 슬롯
+         */
+        [[nodiscard]] void* Allocate();
+
+        /**
+         * @brief 슬롯 반환 (소멸자는 호출하지 않음)
+         * @param slot Allocate 로 받은 슬롯
+         */
+        void Deallocate(void* slot);
+
+        /**
+         * @brief 빈 슬롯이 count 개 이상이 되도록 모자란 만큼을 청크 하나로 할당 (대량 스폰 전에 호출)
+         * @details 새 청크의 슬롯이 Free List 맨 앞에 주소 순으로 들어가므로, 이어지는 Allocate 는 한 블록 안에서 연속된 주소를 반환.
+         *          기존 빈 슬롯은 새 청크를 다 쓴 뒤에 재사용 (메모리를 새로 할당하는 것보다 재사용을 우선)
+         * @param count 이어서 할당할 슬롯 수
+         */
+        void Reserve(uint32 count);
+
+        //////////////////////////////////////////////////////////////
+        // 통계
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 이 풀의 사용 현황 반환
+         */
+        [[nodiscard]] ObjectPoolStats GetStats() const;
+
+        /**
+         * @brief 생성된 모든 풀의 사용 현황 수집
+         * @param outStats 결과를 추가할 배열
+         */
+        static void CollectStats(std::vector<ObjectPoolStats>& outStats);
+
+    private:
+        /**
+         * @brief 빈 슬롯의 앞부분을 Free List 링크로 사용
+         */
+        struct FreeSlot
+        {
+            FreeSlot* Next;
+        };
+
+        /**
+         * @brief 청크 하나를 할당하여 모든 슬롯을 Free List 에 추가
+         * @param slotCount 청크의 슬롯 수
+         */
+        void AllocateChunk(uint32 slotCount);
+
+        static constexpr size_t ChunkByteSize    = 16 * 1024; // 청크 크기 목표 (큰 타입도 청크당 최소 MinSlotsPerChunk 개)
+        static constexpr uint32 MinSlotsPerChunk = 8;
+
+        const char* m_typeName;
+        size_t      m_slotSize;
+        size_t      m_slotAlignment;
+        uint32      m_slotsPerChunk;
+        uint32      m_liveCount = 0;
+        uint32      m_slotCount = 0; // 모든 청크의 슬롯 수 합 (Reserve 로 만든 청크는 크기가 다름)
+
+        FreeSlot*          m_freeList = nullptr;
+        std::vector<void*> m_chunks;
+
+        ObjectPool* m_nextPool = nullptr; // 전역 풀 목록 (침습형 단일 연결 리스트)
+
+        static ObjectPool* s_poolHead;
+    };
+
+    /**
+     * @brief 타입 T 전용 오브젝트 풀 반환 (처음 호출할 때 생성)
+     * @details 풀은 프로그램이 끝날 때까지 소멸시키지 않음 (정적 객체로 둔 Level 등이 풀보다 나중에 소멸해도 슬롯을 안전하게 반환하도록)
+     * @tparam T GameObject 파생 타입
+     */
+    template <typename T>
+    ObjectPool& GetObjectPool()
+    {
+        static ObjectPool* const pool = new ObjectPool(T::StaticClass().GetName(), sizeof(T), alignof(T));
+        return *pool;
+    }
+
+    /**
+     * @brief 풀에서 할당된 객체의 삭제자 (실제 타입의 소멸자를 호출하고 슬롯을 해당 타입의 풀에 반환)
+     * @details 실제 타입별 삭제 함수 포인터 하나만 저장하므로 std::unique_ptr 크기가 포인터 2 개로 유지됨
+     * @tparam Base 보관 타입 (AActor, GActorComponent 등)
+     */
+    template <typename Base>
+    struct TPooledDeleter
+    {
+        void (*Destroy)(Base*) = nullptr;
+
+        void operator()(Base* object) const { Destroy(object); }
+    };
+
+    /**
+     * @brief 풀에서 할당된 객체의 소유 포인터
+     */
+    template <typename Base>
+    using TPooledPtr = std::unique_ptr<Base, TPooledDeleter<Base>>;
+
+    /**
+     * @brief 타입 T 의 풀에서 객체를 생성하여 Base 소유 포인터로 반환 (std::make_unique 대체)
+     * @tparam T 생성할 타입
+     * @tparam Base 소유 포인터의 타입 (T 의 상위 클래스)
+     * @param args 생성자 인자
+     * @return TPooledPtr<Base> 소유 포인터 (해제 시 슬롯이 T 의 풀로 반환됨)
+     */
+    template <typename T, typename Base, typename... Args>
+    TPooledPtr<Base> MakePooled(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Base, T>, "T must derive from Base");
+
+        void* slot   = GetObjectPool<T>().Allocate();
+        T*    object = new (slot) T(std::forward<Args>(args)...);
+
+        // Base* 에서 T* 로의 static_cast 로 원래 슬롯 주소를 복원 (다중 상속이어도 RTTI 불필요)
+        TPooledDeleter<Base> deleter;
+        deleter.Destroy = [](Base* base)
+        {
+            T* derived = static_cast<T*>(base);
+            derived->~T();
+            GetObjectPool<T>().Deallocate(derived);
+        };
+
+        return TPooledPtr<Base>(object, deleter);
+    }
+} // namespace TDME
\ No newline at end of file
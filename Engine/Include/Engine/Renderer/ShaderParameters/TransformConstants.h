@@ -1,13 +1,20 @@
 #pragma once
 
+#include <Core/Math/TMatrix3x4.h>
 #include <Core/Math/TMatrix4x4.h>
 
 namespace TDME
 {
+    /**
+     * @brief 트랜스폼 상수 버퍼 (Common/Transform.hlsli 의 cbuffer Transform 과 같은 배치)
+     * @details World / View 는 항상 아핀 행렬이므로 3x4 (row_major float3x4) 로 전달하여 업로드 크기를 192 → 160 바이트로 줄임
+     */
     struct TransformConstants
     {
-        Matrix World      = Matrix::Identity();
-        Matrix View       = Matrix::Identity();
-        Matrix Projection = Matrix::Identity();
+        Matrix3x4 World      = Matrix3x4::Identity();
+        Matrix3x4 View       = Matrix3x4::Identity();
+        Matrix    Projection = Matrix::Identity();
     };
+
+    static_assert(sizeof(TransformConstants) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
 } // namespace TDME
\ No newline at end of file
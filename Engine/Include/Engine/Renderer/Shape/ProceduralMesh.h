@@ -0,0 +1,228 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/Math/MathConstants.h>
+#include <Core/Math/MathUtils.h>
+#include <Core/Math/TVector2.h>
+#include <Core/Math/TVector3.h>
+
+#include "Engine/Renderer/VertexTypes.h"
+
+#include <array>
+#include <vector>
+
+namespace TDME
+{
+    /**
+     * @brief 절차적(Procedural) 단위 메시 생성
+     * @details 구/원 메시를 constexpr 로 생성하여 자주 쓰는 LOD 는 컴파일 타임 테이블(std::array)로 만들어 둔다.
+     *          시작 시 생성 비용과 매 프레임 삼각함수 비용이 모두 사라지고, 테이블에 없는 LOD 만 런타임에 생성.
+     * @note 삼각함수는 constexpr 로 평가 가능한 Math::FastSinCos (절대 오차 1e-7 이하)를 사용
+     */
+    namespace ProceduralMesh
+    {
+        //////////////////////////////////////////////////////////////
+        // 단위 구 (UV Sphere, radius = 1)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 단위 구의 (stack, slice) 격자 정점
+         * @details phi = π * stack / stacks (위도, +Y 극에서 시작), theta = 2π * slice / slices (경도)
+         * @param stack 위도 인덱스 [0, stacks]
+         * @param slice 경도 인덱스 [0, slices]
+         * @param stacks 세로 줄 분할 수 (위도)
+         * @param slices 가로 줄 분할 수 (경도)
+         * @return constexpr VertexPT 위치 + UV (U: 경도 0->1, V: 위도 0->1)
+         */
+        constexpr VertexPT MakeSphereVertex(uint32 stack, uint32 slice, uint32 stacks, uint32 slices)
+        {
+            float sinPhi = 0.0f, cosPhi = 0.0f;
+            float sinTheta = 0.0f, cosTheta = 0.0f;
+            Math::FastSinCos(Math::Pi * static_cast<float>(stack) / static_cast<float>(stacks), sinPhi, cosPhi);
+            Math::FastSinCos(Math::Pi2 * static_cast<float>(slice) / static_cast<float>(slices), sinTheta, cosTheta);
+
+            return VertexPT(Vector3(sinPhi * cosTheta, cosPhi, sinPhi * sinTheta),
+                            Vector2(static_cast<float>(slice) / static_cast<float>(slices), static_cast<float>(stack) / static_cast<float>(stacks)));
+        }
+
+        /**
+         * @brief 단위 구 인덱스 버퍼의 index 번째 값 (삼각형 리스트)
+         * @details 격자 한 칸(quad)마다 6개: (topLeft, topRight, bottomLeft), (topRight, bottomRight, bottomLeft)
+         */
+        constexpr uint16 MakeSphereIndex(uint32 index, uint32 slices)
+        {
+            const uint32 quad   = index / 6;
+            const uint32 corner = index % 6;
+            const uint32 stack  = quad / slices;
+            const uint32 slice  = quad % slices;
+
+            const uint32 topLeft     = stack * (slices + 1) + slice;
+            const uint32 topRight    = topLeft + 1;
+            const uint32 bottomLeft  = topLeft + (slices + 1);
+            const uint32 bottomRight = bottomLeft + 1;
+
+            constexpr uint32 order[6] = { 0, 1, 2, 1, 3, 2 }; // 0: topLeft, 1: topRight, 2: bottomLeft, 3: bottomRight
+            const uint32     corners[4] = { topLeft, topRight, bottomLeft, bottomRight };
+            return static_cast<uint16>(corners[order[corner]]);
+        }
+
+        /**
+         * @brief 컴파일 타임 단위 구 메시
+         * @tparam Stacks 세로 줄 분할 수 (위도)
+         * @tparam Slices 가로 줄 분할 수 (경도)
+         */
+        template <uint32 Stacks, uint32 Slices>
+        struct TSphereMesh
+        {
+            static_assert(Stacks >= 2 && Slices >= 3, "Sphere needs at least 2 stacks and 3 slices");
+            static_assert((Stacks + 1) * (Slices + 1) <= 65536, "Sphere vertex count exceeds uint16 index range");
+
+            static constexpr uint32 VertexCount = (Stacks + 1) * (Slices + 1);
+            static constexpr uint32 IndexCount  = Stacks * Slices * 6;
+
+            std::array<VertexPT, VertexCount> Vertices{};
+            std::array<uint16, IndexCount>    Indices{};
+        };
+
+        /**
+         * @brief 단위 구 메시 생성 (constexpr)
+         */
+        template <uint32 Stacks, uint32 Slices>
+        constexpr TSphereMesh<Stacks, Slices> MakeUnitSphere()
+        {
+            TSphereMesh<Stacks, Slices> mesh;
+            for (uint32 i = 0; i <= Stacks; i++)
+            {
+                for (uint32 j = 0; j <= Slices; j++)
+                {
+                    mesh.Vertices[i * (Slices + 1) + j] = MakeSphereVertex(i, j, Stacks, Slices);
+                }
+            }
+            for (uint32 i = 0; i < TSphereMesh<Stacks, Slices>::IndexCount; i++)
+            {
+                mesh.Indices[i] = MakeSphereIndex(i, Slices);
+            }
+            return mesh;
+        }
+
+        /**
+         * @brief 컴파일 타임에 생성된 단위 구 (정적 데이터 영역에 배치)
+         */
+        template <uint32 Stacks, uint32 Slices>
+        INLINE constexpr TSphereMesh<Stacks, Slices> UnitSphere = MakeUnitSphere<Stacks, Slices>();
+
+        //////////////////////////////////////////////////////////////
+        // 단위 원 (radius = 1)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 컴파일 타임 단위 원 둘레 점
+         * @details Points[i] = (cos θ, sin θ), θ = 2π * i / Segments (i = 0 ~ Segments, 마지막 점은 첫 점과 같은 위치)
+         * @tparam Segments 분할 수
+         */
+        template <uint32 Segments>
+        struct TCircleMesh
+        {
+            static_assert(Segments >= 3, "Circle needs at least 3 segments");
+
+            static constexpr uint32 PointCount = Segments + 1;
+
+            std::array<Vector2, PointCount> Points{};
+        };
+
+        /**
+         * @brief 단위 원 둘레 점 생성 (constexpr)
+         */
+        template <uint32 Segments>
+        constexpr TCircleMesh<Segments> MakeUnitCircle()
+        {
+            TCircleMesh<Segments> mesh;
+            for (uint32 i = 0; i <= Segments; i++)
+            {
+                float s = 0.0f, c = 0.0f;
+                Math::FastSinCos(Math::Pi2 * static_cast<float>(i) / static_cast<float>(Segments), s, c);
+                mesh.Points[i] = Vector2(c, s);
+            }
+            return mesh;
+        }
+
+        /**
+         * @brief 컴파일 타임에 생성된 단위 원 (정적 데이터 영역에 배치)
+         */
+        template <uint32 Segments>
+        INLINE constexpr TCircleMesh<Segments> UnitCircle = MakeUnitCircle<Segments>();
+
+        //////////////////////////////////////////////////////////////
+        // 미리 생성된 LOD 조회
+        // 런타임 stacks/slices/segments 값이 아래 LOD 중 하나면 컴파일 타임 테이블을 사용하고, 아니면 false 를 반환 (호출자가 런타임 생성)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 미리 생성된 단위 구 데이터 (포인터 + 개수)
+         */
+        struct SphereMeshView
+        {
+            const VertexPT* Vertices    = nullptr;
+            const uint16*   Indices     = nullptr;
+            uint32          VertexCount = 0;
+            uint32          IndexCount  = 0;
+        };
+
+        /**
+         * @brief 미리 생성된 단위 원 데이터 (포인터 + 개수)
+         */
+        struct CircleMeshView
+        {
+            const Vector2* Points     = nullptr;
+            uint32         PointCount = 0;
+        };
+
+        template <uint32 Stacks, uint32 Slices>
+        constexpr SphereMeshView GetView(const TSphereMesh<Stacks, Slices>& mesh)
+        {
+            return { mesh.Vertices.data(), mesh.Indices.data(), TSphereMesh<Stacks, Slices>::VertexCount, TSphereMesh<Stacks, Slices>::IndexCount };
+        }
+
+        template <uint32 Segments>
+        constexpr CircleMeshView GetView(const TCircleMesh<Segments>& mesh)
+        {
+            return { mesh.Points.data(), TCircleMesh<Segments>::PointCount };
+        }
+
+        /**
+         * @brief 미리 생성된 단위 구 조회 (8x16, 16x32, 32x64)
+         * @param stacks 세로 줄 분할 수 (위도)
+         * @param slices 가로 줄 분할 수 (경도)
+         * @param outView 조회 결과
+         * @return bool 미리 생성된 LOD 가 있으면 true
+         */
+        bool FindUnitSphere(uint32 stacks, uint32 slices, SphereMeshView& outView);
+
+        /**
+         * @brief 미리 생성된 단위 원 조회 (16, 32, 64 분할)
+         * @param segments 분할 수
+         * @param outView 조회 결과
+         * @return bool 미리 생성된 LOD 가 있으면 true
+         */
+        bool FindUnitCircle(uint32 segments, CircleMeshView& outView);
+
+        //////////////////////////////////////////////////////////////
+        // 런타임 생성 (미리 생성된 LOD 가 없을 때)
+        // 컴파일 타임 테이블과 같은 정점 순서 / UV / 인덱스 배치로 생성
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 단위 구 런타임 생성
+         * @details 위도/경도 sin/cos 테이블을 (stacks + slices) 번만 계산하여 정점을 채움
+         * @param outVertices 정점 ((stacks + 1) * (slices + 1) 개)
+         * @param outIndices 인덱스 (stacks * slices * 6 개)
+         */
+        void BuildUnitSphere(uint32 stacks, uint32 slices, std::vector<VertexPT>& outVertices, std::vector<uint16>& outIndices);
+
+        /**
+         * @brief 단위 원 둘레 점 런타임 생성
+         * @param outPoints 둘레 점 (segments + 1 개)
+         */
+        void BuildUnitCircle(uint32 segments, std::vector<Vector2>& outPoints);
+    } // namespace ProceduralMesh
+} // namespace TDME
\ No newline at end of file
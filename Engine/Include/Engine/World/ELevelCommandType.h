@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+namespace TDME
+{
+    /**
+     * @brief 지연 명령 종류 (LevelCommandBuffer 에 기록되어 동기화 지점에서 메인 스레드가 재생)
+     * @see TDME::LevelCommandBuffer
+     */
+    enum class ELevelCommandType : uint8
+    {
+        SpawnActor,      /** Actor 스폰 후 초기화 함수 호출 */
+        DestroyActor,    /** Actor 삭제 예약 (Level::DestroyActor) */
+        AttachComponent, /** SceneComponent 를 다른 SceneComponent 에 부착 */
+        DetachComponent, /** SceneComponent 를 부모에서 분리 */
+    };
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+namespace TDME
+{
+    /**
+     * @brief Tick 그룹 (Level::Update 에서 그룹 순서대로 실행)
+     * @details 같은 그룹의 객체는 서로 독립적으로 취급되어 병렬 실행될 수 있으며, 앞 그룹이 모두 끝나야 다음 그룹이 시작됨
+     * @see TDME::TickManager, TDME::AActor::SetTickGroup
+     */
+    enum class ETickGroup : uint8
+    {
+        PrePhysics,     /** 물리 이전 - 기본 값 (이동 / 입력 처리 등) */
+        DuringPhysics,  /** 물리와 함께 실행 (물리 결과에 의존하지 않는 작업) */
+        PostPhysics,    /** 물리 이후 (물리 결과를 읽는 작업) */
+        PostUpdateWork, /** 모든 Update 이후 (카메라 추적 등 최종 트랜스폼에 의존하는 작업) */
+
+        Count
+    };
+} // namespace TDME
\ No newline at end of file
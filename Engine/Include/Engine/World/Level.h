@@ -1,20 +1,42 @@
 #pragma once
 
+#include <Core/Async/JobSystem.h>
+
+#include "Engine/Object/IRenderable.h"
+#include "Engine/Object/ObjectPool.h"
+#include "Engine/World/ObjectHandleTable.h"
+#include "Engine/World/TickManager.h"
+#include "Engine/World/TransformHierarchy.h"
+
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 namespace TDME
 {
     class AActor;
+    class LevelCommandBuffer;
 
     /**
      * @brief Level: 월드 내의 맵 혹은 여러 맵에 지속되는 게임 플레이 영역.
      * @details Actor를 소유하고 일괄 Update/Render를 수행하는 컨테이너.
+     * @li IRenderable Actor 는 스폰 시 렌더 목록에 등록되어, Render 는 렌더링 가능한 Actor 만 연속 배열로 순회
+     * @li Actor 는 Actor 목록 / 렌더 목록 내 자신의 인덱스를 기억하므로 삭제는 맨 끝 요소와 교체 후 제거 (삭제 수에 비례, 목록 순서는 유지되지 않음)
+     * @li Actor 는 타입별 오브젝트 풀에서 할당하고, FlushPendingDestroy 에서 삭제된 Actor 의 슬롯은 풀에 반환되어 다음 스폰에서 재사용
+     * @li 스폰된 Actor 와 컴포넌트는 ObjectHandleTable 에서 객체 ID 를 발급받아 ObjectHandle 로 안전하게 참조 가능
+     * @li Update 는 TickManager 가 Update 를 재정의한 Actor / 컴포넌트만 실제 타입별로 묶어 호출
+     *     (Tick 그룹 / 선행 조건 순서대로, 병렬 Tick 을 허용한 객체는 작업 시스템에서 병렬 실행)
+     * @li 병렬 Tick / 작업에서의 스폰 / 삭제 / 부착 / 분리는 스레드별 LevelCommandBuffer 에 기록하고 동기화 지점에서 정해진 순서로 재생
      */
     class Level
     {
     public:
-        Level();
+        /**
+         * @brief Level 생성
+         * @param handleTable 객체 ID 를 발급할 핸들 테이블 (World 소유, nullptr 이면 Level 이 직접 소유)
+         * @param jobSystem 병렬 Tick 에 사용할 작업 시스템 (World 소유, nullptr 이면 모든 Tick 을 메인 스레드에서 실행)
+         */
+        explicit Level(ObjectHandleTable* handleTable = nullptr, JobSystem* jobSystem = nullptr);
         ~Level();
 
         //////////////////////////////////////////////////////////////
@@ -29,6 +51,7 @@ namespace TDME
 
         /**
          * @brief 매 프레임 렌더링 호출
+         * @details 렌더 목록에 등록된 IRenderable 만 순회 (Actor 전체를 순회하며 타입을 확인하지 않음)
          */
         void Render();
 
@@ -46,35 +69,253 @@ namespace TDME
         template <typename T, typename... Args>
         T* SpawnActor(Args&&... args)
         {
-            static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor");
+            T* ptr = CreateActor<T>(std::forward<Args>(args)...);
+            ptr->BeginPlay();
+            return ptr;
+        }
+
+        /**
+         * @brief 같은 타입의 Actor 여러 개를 한꺼번에 생성 (레벨 로드 / 웨이브 스폰 등)
+         * @details SpawnActor 를 count 번 호출하는 것과 같은 결과지만
+         * @li Actor 목록 / 렌더 목록의 용량을 한 번에 확보하고, Actor 슬롯을 풀에서 한 블록으로 할당하여 주소 순으로 연속 생성
+         * @li 모두 생성 / 등록 / 초기화한 뒤 BeginPlay 를 한 번에 호출 (실제 타입의 BeginPlay 를 직접 호출하므로 가상 호출 없음)
+         * @li isParallelBeginPlay 면 BeginPlay 를 작업 시스템에서 병렬 실행 (병렬 Tick 과 같은 규칙: 자신의 상태만 변경하고 구조 변경은 GetCommandBuffer 에 기록)
+         * @tparam T 생성할 AActor 파생 클래스 (기본 생성자 필요)
+         * @tparam InitFunc void(T& actor, uint32 index) 형태의 호출 가능 객체
+         * @param count 생성할 Actor 수
+         * @param init BeginPlay 전에 메인 스레드에서 Actor 마다 호출할 초기화 함수 (위치 설정, 포인터 보관 등)
+         * @param isParallelBeginPlay BeginPlay 를 병렬 실행할지 여부 (작업 시스템이 없으면 무시)
+         * @note init 에서 SpawnActor 로 다른 Actor 를 스폰하면 그 Actor 는 즉시 BeginPlay 되고 일괄 처리 대상에는 포함되지 않음.
+         *       병렬 BeginPlay 안에서는 직접 스폰할 수 없음 (디버그 빌드에서 검사, GetCommandBuffer().SpawnActor 로 기록할 것)
+         * @code
+         * level.SpawnActors<AAsteroid>(50000, [&](AAsteroid& asteroid, uint32 index) {
+         *     asteroid.GetRootComponent()->SetPosition(positions[index]);
+         * });
+         * @endcode
+         */
+        template <typename T, typename InitFunc>
+        void SpawnActors(uint32 count, InitFunc&& init, bool isParallelBeginPlay = false)
+        {
+            if (count == 0)
+                return;
 
-            // 1. Actor 생성
-            auto actor = std::make_unique<T>(std::forward<Args>(args)...);
-            T*   ptr   = actor.get();
+            // 1. 용량 확보 (Actor 슬롯은 풀에서 한 블록으로 할당하고, 목록은 스폰마다 다시 할당되지 않도록)
+            GetObjectPool<T>().Reserve(count);
 
-            // 2. Actor 소유권 이전
-            m_actors.push_back(std::move(actor));
+            ReserveAdditional(m_actors, count);
+            if constexpr (std::is_base_of_v<IRenderable, T>)
+            {
+                ReserveAdditional(m_renderables, count);
+                ReserveAdditional(m_renderableOwners, count);
+            }
 
-            // 3. BeginPlay 호출
-            ptr->BeginPlay();
-            return ptr;
+            // 2. 첫 Actor 가 등록한 노드 / 객체 수로 나머지 Actor 의 트랜스폼 계층 구조 / 핸들 테이블 용량 확보
+            //    (컴포넌트 구성은 생성자에서 정해지므로 하나를 만들어 보기 전에는 알 수 없음)
+            const uint32 nodeCount   = m_transformHierarchy.GetNodeCount();
+            const uint32 objectCount = m_handleTable->GetLiveCount();
+            T*           firstActor  = CreateActor<T>();
+            m_transformHierarchy.Reserve((m_transformHierarchy.GetNodeCount() - nodeCount) * (count - 1));
+            m_handleTable->Reserve((m_handleTable->GetLiveCount() - objectCount) * (count - 1));
+
+            // 3. 생성 / 등록 / 초기화 (BeginPlay 는 아직 호출하지 않음)
+            //    생성한 Actor 는 따로 모아 둠 (init 에서 다른 Actor 를 스폰하면 m_actors 의 인덱스가 연속이 아니게 됨)
+            std::vector<T*> actors;
+            actors.reserve(count);
+            actors.push_back(firstActor);
+            init(*firstActor, 0);
+            for (uint32 i = 1; i < count; i++)
+            {
+                T* actor = CreateActor<T>();
+                actors.push_back(actor);
+                init(*actor, i);
+            }
+
+            // 4. BeginPlay 일괄 호출
+            if (isParallelBeginPlay && m_jobSystem)
+            {
+                // 병렬 구간에서 CreateActor 는 TDME_ASSERT 로 막힘 (스폰은 GetCommandBuffer() 로 기록)
+                m_transformHierarchy.BeginDeferredChanges();
+                m_jobSystem->ParallelFor(count, 0, [&actors](uint32 begin, uint32 end)
+                {
+                    for (uint32 i = begin; i < end; i++)
+                    {
+                        actors[i]->T::BeginPlay();
+                    }
+                });
+                m_transformHierarchy.EndDeferredChanges();
+
+                FlushCommands(); // 병렬 BeginPlay 에서 기록한 구조 변경 재생
+            }
+            else
+            {
+                for (T* actor : actors)
+                {
+                    actor->T::BeginPlay();
+                }
+            }
+        }
+
+        /**
+         * @brief 같은 타입의 Actor 여러 개를 한꺼번에 생성 (초기화 없음)
+         */
+        template <typename T>
+        void SpawnActors(uint32 count)
+        {
+            SpawnActors<T>(count, [](T&, uint32) {});
         }
 
         /**
          * @brief Actor 지연 삭제 예약 (PendingDestroy)
-         * @details 즉시 삭제하지 않고 다음 Update 에서 FlushPendingDestroy 에서 실제 삭제
+         * @details 즉시 삭제하지 않고 다음 Update 에서 FlushPendingDestroy 에서 실제 삭제.
+         *          Actor 의 삭제 예약 플래그로 중복을 걸러내므로 O(1)
          * @note 즉시 삭제할 경우 이터레이터 무효화, 멀티 스레드, 다중 접근 등 문제가 발생할 수 있음
          * @param actor 파괴할 Actor
          */
         void DestroyActor(AActor* actor);
 
+        //////////////////////////////////////////////////////////////
+        // 지연 명령
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 현재 스레드의 지연 명령 버퍼 반환 (병렬 Tick / 작업에서 구조 변경을 기록할 때 사용)
+         * @note 메인 스레드와 이 Level 의 JobSystem 작업 스레드에서만 호출할 것
+         * @see TDME::LevelCommandBuffer
+         */
+        [[nodiscard]] LevelCommandBuffer& GetCommandBuffer();
+
+        /**
+         * @brief 모든 스레드의 지연 명령을 정렬 키 순으로 재생 (메인 스레드, 병렬 작업이 모두 끝난 뒤 호출)
+         * @details 병렬 Tick 구간이 끝날 때와 Update 의 Tick 이후에 자동으로 호출되므로, 그 밖의 병렬 작업 뒤에 결과가 바로 필요할 때만 직접 호출
+         */
+        void FlushCommands();
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 트랜스폼 계층 구조 반환
+         */
+        [[nodiscard]] TransformHierarchy& GetTransformHierarchy() { return m_transformHierarchy; }
+
+        /**
+         * @brief Tick 관리자 반환
+         */
+        [[nodiscard]] TickManager& GetTickManager() { return m_tickManager; }
+
+        /**
+         * @brief 객체 핸들 테이블 반환
+         */
+        [[nodiscard]] ObjectHandleTable& GetHandleTable() const { return *m_handleTable; }
+
+        /**
+         * @brief 객체 ID 로 객체 조회 (O(1), 삭제된 객체면 nullptr)
+         * @param id 객체 ID
+         */
+        [[nodiscard]] GameObject* FindObject(ObjectID id) const { return m_handleTable->Find(id); }
+
+        /**
+         * @brief 핸들이 가리키는 객체 반환 (O(1), 삭제되었거나 T 가 아니면 nullptr)
+         * @tparam T 핸들 타입
+         * @param handle 객체 핸들
+         */
+        template <typename T>
+        [[nodiscard]] T* Resolve(ObjectHandle<T> handle) const
+        {
+            return m_handleTable->Resolve(handle);
+        }
+
+        /**
+         * @brief 렌더 목록에 등록된 IRenderable 수 반환
+         */
+        [[nodiscard]] size_t GetRenderableCount() const { return m_renderables.size(); }
+
     private:
+        friend class LevelCommandBuffer; // 스폰 명령 재생 시 CreateActor → 초기화 → BeginPlay 순으로 호출
+
+        /**
+         * @brief Actor 를 생성하여 Level 에 등록 (BeginPlay 는 호출하지 않음)
+         */
+        template <typename T, typename... Args>
+        T* CreateActor(Args&&... args)
+        {
+            static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor");
+            TDME_ASSERT(!m_transformHierarchy.IsDeferringChanges(), "Spawning inside a parallel phase; record it with GetCommandBuffer().SpawnActor");
+
+            // 1. Actor 생성 (타입별 풀에서 할당)
+            auto actor = MakePooled<T, AActor>(std::forward<Args>(args)...);
+            T*   ptr   = static_cast<T*>(actor.get());
+
+            // 2. Actor 소유권 이전 (삭제 시 바로 제거할 수 있도록 인덱스 기록)
+            ptr->m_levelIndex    = static_cast<uint32>(m_actors.size());
+            ptr->m_tick.Function = TickManager::GetTickFunction<T, AActor>(); // Update 를 재정의한 타입만 Tick
+            m_actors.push_back(std::move(actor));
+
+            // 3. Level 등록 (SceneComponent 를 트랜스폼 계층 구조에, Tick 대상을 TickManager 에 등록)
+            ptr->RegisterToLevel(this);
+
+            // 4. 렌더링 가능한 Actor 면 렌더 목록에 등록 (컴파일 타임에 판별하므로 dynamic_cast 불필요)
+            if constexpr (std::is_base_of_v<IRenderable, T>)
+            {
+                ptr->m_renderableIndex = static_cast<uint32>(m_renderables.size());
+                m_renderables.push_back(ptr);
+                m_renderableOwners.push_back(ptr);
+            }
+
+            return ptr;
+        }
+
+        /**
+         * @brief 배열에 count 개를 더 추가할 용량 확보 (여러 번 호출해도 재할당이 누적되지 않도록 최소 두 배로 늘림)
+         */
+        template <typename Vector>
+        static void ReserveAdditional(Vector& vector, size_t count)
+        {
+            const size_t required = vector.size() + count;
+            if (required > vector.capacity())
+            {
+                vector.reserve(std::max(required, vector.capacity() * 2));
+            }
+        }
+
         /**
          * @brief 지연 삭제 대기중인 Actor들을 실제로 삭제
          */
         void FlushPendingDestroy();
 
-        std::vector<std::unique_ptr<AActor>> m_actors;
-        std::vector<AActor*>                 m_pendingDestroy;
+        /**
+         * @brief Actor 를 Actor 목록 / 렌더 목록에서 제거하고 삭제 (맨 끝 요소와 교체 후 제거, O(1))
+         * @param actor 삭제할 Actor
+         */
+        void RemoveActor(AActor* actor);
+
+        /**
+         * @brief 재생할 명령 (정렬 키 → 버퍼 인덱스 → 기록 순)
+         */
+        struct CommandEntry
+        {
+            ObjectID SortKey;
+            uint32   BufferIndex;
+            uint32   CommandIndex;
+        };
+
+        TransformHierarchy                 m_transformHierarchy; // Actor 보다 먼저 선언 (Actor 의 컴포넌트가 소멸 시 등록 해제하므로 나중에 소멸해야 함)
+        TickManager                        m_tickManager;        // Actor 보다 먼저 선언 (Actor 가 삭제 전 등록 해제하므로 나중에 소멸해야 함)
+        std::unique_ptr<ObjectHandleTable> m_ownedHandleTable;   // World 없이 단독으로 생성된 경우에만 사용
+        ObjectHandleTable*                 m_handleTable;
+        JobSystem*                         m_jobSystem;
+
+        // 지연 명령 (스레드 인덱스별 기록 버퍼와, 재생하는 동안 기록 버퍼와 교환해 두는 재생 버퍼)
+        std::vector<std::unique_ptr<LevelCommandBuffer>> m_commandBuffers;
+        std::vector<std::unique_ptr<LevelCommandBuffer>> m_playbackBuffers;
+        std::vector<CommandEntry>                        m_commandEntries;
+
+        std::vector<TPooledPtr<AActor>> m_actors;
+        std::vector<AActor*>            m_pendingDestroy;
+
+        // 렌더 목록 (인덱스가 같은 요소끼리 한 항목, Render 는 m_renderables 만 순회)
+        std::vector<IRenderable*> m_renderables;
+        std::vector<AActor*>      m_renderableOwners; // 교체 후 제거 시 옮겨진 항목의 인덱스를 갱신하기 위한 소유 Actor
     };
 } // namespace TDME
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+#include "Engine/Object/ObjectHandle.h"
+#include "Engine/World/ELevelCommandType.h"
+#include "Engine/World/Level.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace TDME
+{
+    class GSceneComponent;
+
+    /**
+     * @brief Level 구조 변경 지연 명령 버퍼
+     * @details 병렬 Tick / 작업에서는 Actor 목록과 부모-자식 연결을 직접 바꿀 수 없으므로, 스폰 / 삭제 / 부착 / 분리를 명령으로 기록해 두고
+     *          동기화 지점에서 메인 스레드가 한꺼번에 재생.
+     * @li 스레드마다 버퍼가 따로 있으므로 기록할 때 잠금이 없음 (Level::GetCommandBuffer 가 현재 스레드의 버퍼를 반환)
+     * @li 재생 순서는 정렬 키 순이고, 같은 키끼리는 기록 순 (어느 스레드가 어떤 객체를 실행했는지와 무관하게 같은 결과)
+     * @li 정렬 키는 보통 명령을 기록한 객체의 ID (GetObjectID()). 한 구간에서 같은 키를 여러 스레드가 쓰면 그 명령들의 순서는 정해지지 않음
+     * @li 대상은 객체 ID 로 기록하므로 재생 전에 삭제된 대상의 명령은 무시됨
+     * @li 동기화 지점: 병렬 Tick 구간이 끝날 때마다(같은 단계의 메인 스레드 Tick 전) 와 Level::Update 의 Tick 이후, 그리고 Level::FlushCommands
+     * @note 재생 중에 새로 기록한 명령은 다음 동기화 지점에서 재생
+     * @code
+     * void ATurret::Update(float deltaTime) // 병렬 Tick
+     * {
+     *     LevelCommandBuffer& commands = GetLevel()->GetCommandBuffer();
+     *     const Vector3       muzzle   = GetRootComponent()->GetTransform().Position;
+     *     commands.SpawnActor<ABullet>(GetObjectID(), [muzzle](ABullet& bullet) { bullet.GetRootComponent()->SetPosition(muzzle); });
+     * }
+     * @endcode
+     * @see TDME::Level
+     */
+    class LevelCommandBuffer
+    {
+    public:
+        LevelCommandBuffer() = default;
+
+        LevelCommandBuffer(const LevelCommandBuffer&)            = delete;
+        LevelCommandBuffer& operator=(const LevelCommandBuffer&) = delete;
+
+        //////////////////////////////////////////////////////////////
+        // 기록
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Actor 스폰 기록
+         * @details 재생 시 Actor 를 생성 / 등록한 뒤 init 을 호출하고, 그 다음 BeginPlay 를 호출 (Level::SpawnActors 와 같은 순서).
+         *          BeginPlay 는 init 에서 설정한 값(위치 등)을 볼 수 있음
+         * @tparam T 생성할 AActor 파생 클래스
+         * @tparam InitFunc void(T&) 형태의 호출 가능 객체 (버퍼에 그대로 복사되므로 값 / 핸들만 캡처할 것)
+         * @param sortKey 재생 순서 정렬 키 (보통 기록한 객체의 ID)
+         * @param init 스폰된 Actor 초기화 함수 (BeginPlay 전에 메인 스레드에서 호출)
+         */
+        template <typename T, typename InitFunc>
+        void SpawnActor(ObjectID sortKey, const InitFunc& init)
+        {
+            static_assert(std::is_base_of_v<AActor, T>, "T must be derived from AActor");
+            static_assert(std::is_trivially_copyable_v<InitFunc> && std::is_trivially_destructible_v<InitFunc>,
+                          "InitFunc must only capture trivially copyable values (positions, handles, ...)");
+            static_assert(alignof(InitFunc) <= alignof(std::max_align_t), "InitFunc alignment is not supported");
+
+            // 초기화 함수를 바이트 버퍼에 복사 (명령마다 힙 할당하지 않음)
+            const size_t offset = (m_payload.size() + alignof(InitFunc) - 1) & ~(alignof(InitFunc) - 1);
+            m_payload.resize(offset + sizeof(InitFunc));
+            new (m_payload.data() + offset) InitFunc(init);
+
+            Command& command      = AddCommand(ELevelCommandType::SpawnActor, sortKey);
+            command.PayloadOffset = static_cast<uint32>(offset);
+            command.Spawn         = [](Level& level, const void* payload)
+            {
+                // 생성 → 초기화 → BeginPlay
+                T* actor = level.CreateActor<T>();
+                (*static_cast<const InitFunc*>(payload))(*actor);
+                actor->BeginPlay();
+            };
+        }
+
+        /**
+         * @brief Actor 스폰 기록 (초기화 없음)
+         */
+        template <typename T>
+        void SpawnActor(ObjectID sortKey)
+        {
+            SpawnActor<T>(sortKey, [](T&) {});
+        }
+
+        /**
+         * @brief Actor 삭제 기록 (재생 시 Level::DestroyActor)
+         * @param sortKey 재생 순서 정렬 키
+         * @param actor 삭제할 Actor
+         */
+        void DestroyActor(ObjectID sortKey, const AActor* actor);
+
+        /**
+         * @brief SceneComponent 부착 기록 (재생 시 GSceneComponent::AttachToComponent)
+         * @param sortKey 재생 순서 정렬 키
+         * @param child 부착할 컴포넌트
+         * @param parent 부모 컴포넌트
+         */
+        void AttachComponent(ObjectID sortKey, const GSceneComponent* child, const GSceneComponent* parent);
+
+        /**
+         * @brief SceneComponent 분리 기록 (재생 시 GSceneComponent::DetachFromParent)
+         * @param sortKey 재생 순서 정렬 키
+         * @param child 분리할 컴포넌트
+         */
+        void DetachComponent(ObjectID sortKey, const GSceneComponent* child);
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 기록된 명령 수 반환
+         */
+        [[nodiscard]] uint32 GetCommandCount() const { return static_cast<uint32>(m_commands.size()); }
+
+        /**
+         * @brief 기록된 명령이 없는지 여부
+         */
+        [[nodiscard]] bool IsEmpty() const { return m_commands.empty(); }
+
+    private:
+        friend class Level;
+
+        using SpawnFunction = void (*)(Level& level, const void* payload);
+
+        /**
+         * @brief 기록된 명령
+         */
+        struct Command
+        {
+            ELevelCommandType Type;
+            ObjectID          SortKey;
+            ObjectID          Target        = InvalidObjectID; // 삭제할 Actor / 부착 / 분리할 컴포넌트
+            ObjectID          Parent        = InvalidObjectID; // 부착할 부모 컴포넌트
+            SpawnFunction     Spawn         = nullptr;         // 실제 타입으로 스폰 후 초기화 함수 호출
+            uint32            PayloadOffset = 0;               // 초기화 함수의 바이트 버퍼 내 위치
+        };
+
+        /**
+         * @brief 명령 추가
+         */
+        Command& AddCommand(ELevelCommandType type, ObjectID sortKey);
+
+        /**
+         * @brief index 번째 명령 재생 (메인 스레드, Level::FlushCommands 에서 호출)
+         */
+        void Execute(Level& level, uint32 index) const;
+
+        /**
+         * @brief 기록된 명령 / 초기화 함수 삭제 (용량은 유지하여 다음 프레임에 재사용)
+         */
+        void Clear();
+
+        /**
+         * @brief 다른 버퍼와 내용 교환 (재생하는 동안 새 기록이 재생 중인 버퍼를 바꾸지 않도록)
+         */
+        void Swap(LevelCommandBuffer& other);
+
+        std::vector<Command> m_commands;
+        std::vector<uint8>   m_payload; // 스폰 초기화 함수 저장소 (std::allocator 의 기본 정렬 이하인 타입만 저장)
+    };
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+#include "Engine/Object/GameObject.h"
+#include "Engine/Object/ObjectHandle.h"
+
+#include <vector>
+
+namespace TDME
+{
+    /**
+     * @brief 객체 핸들 테이블
+     * @details 등록된 GameObject 를 슬롯 배열에 저장하고 (슬롯 인덱스, 세대)로 이루어진 객체 ID 를 발급.
+     * @li 조회는 인덱스로 슬롯에 바로 접근한 뒤 세대만 비교하므로 O(1) (Actor 목록 탐색 / 해시 없음)
+     * @li 등록 해제 시 슬롯의 세대를 올려 이전 ID 와 핸들을 모두 무효화하고, 슬롯은 Free List 로 재사용
+     * @note World 가 소유하고 World 의 Level 들이 공유 (Level 을 단독으로 만들면 Level 이 직접 소유)
+     * @see TDME::ObjectHandle, TDME::World, TDME::Level
+     */
+    class ObjectHandleTable
+    {
+    public:
+        ObjectHandleTable();
+        ~ObjectHandleTable();
+
+        ObjectHandleTable(const ObjectHandleTable&)            = delete;
+        ObjectHandleTable& operator=(const ObjectHandleTable&) = delete;
+
+        //////////////////////////////////////////////////////////////
+        // 등록
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 객체 등록 및 객체 ID 발급 (이미 등록된 객체면 기존 ID 반환)
+         * @param object 등록할 객체
+         * @return ObjectID 발급된 객체 ID (object->GetObjectID() 와 같음)
+         */
+        ObjectID Register(GameObject* object);
+
+        /**
+         * @brief 객체 count 개를 더 등록할 슬롯 용량 확보 (재사용 대기 중인 슬롯은 고려하지 않음)
+         * @param count 추가로 등록할 객체 수
+         */
+        void Reserve(uint32 count);
+
+        /**
+         * @brief 객체 등록 해제 (이 객체를 가리키던 ID / 핸들은 모두 무효화)
+         * @param object 등록 해제할 객체
+         */
+        void Unregister(GameObject* object);
+
+        //////////////////////////////////////////////////////////////
+        // 조회
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 객체 ID 로 객체 조회 (O(1))
+         * @param id 객체 ID
+         * @return GameObject* 살아 있는 객체 (삭제되었거나 잘못된 ID 면 nullptr)
+         */
+        [[nodiscard]] GameObject* Find(ObjectID id) const
+        {
+            const uint32 index = GetObjectIndex(id);
+            if (index >= m_slots.size())
+                return nullptr;
+
+            const Slot& slot = m_slots[index];
+            return slot.Generation == GetObjectGeneration(id) ? slot.Object : nullptr;
+        }
+
+        /**
+         * @brief 핸들이 가리키는 객체 반환 (O(1))
+         * @tparam T 핸들 타입 (TDME_OBJECT_CLASS 를 선언한 GameObject 파생 타입)
+         * @param handle 객체 핸들
+         * @return T* 살아 있는 T 객체 (삭제되었거나 T 가 아니면 nullptr)
+         */
+        template <typename T>
+        [[nodiscard]] T* Resolve(ObjectHandle<T> handle) const
+        {
+            // 핸들은 객체 ID 로도 만들 수 있으므로 (LevelCommandBuffer 등) 다른 타입의 객체를 가리킬 수 있음 → Cast 로 타입 검사 (O(1))
+            return Cast<T>(Find(handle.GetID()));
+        }
+
+        /**
+         * @brief 객체 ID 가 살아 있는 객체를 가리키는지 여부 (O(1))
+         */
+        [[nodiscard]] bool IsValid(ObjectID id) const { return Find(id) != nullptr; }
+
+        /**
+         * @brief 등록된 객체 수 반환
+         */
+        [[nodiscard]] uint32 GetLiveCount() const { return m_liveCount; }
+
+        /**
+         * @brief 할당된 슬롯 수 반환 (재사용 대기 중인 슬롯 포함)
+         */
+        [[nodiscard]] uint32 GetSlotCount() const { return static_cast<uint32>(m_slots.size()); }
+
+    private:
+        struct Slot
+        {
+            GameObject* Object;     // 비어 있으면 nullptr
+            uint32      Generation; // 등록 해제될 때마다 증가 (0 은 사용하지 않음)
+            uint32      NextFree;   // 비어 있을 때 다음 빈 슬롯 인덱스
+        };
+
+        static constexpr uint32 InvalidIndex = ~0u;
+
+        std::vector<Slot> m_slots;
+        uint32            m_freeHead  = InvalidIndex;
+        uint32            m_liveCount = 0;
+    };
+} // namespace TDME
\ No newline at end of file
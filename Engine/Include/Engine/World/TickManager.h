@@ -0,0 +1,314 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+
+#include "Engine/Object/IUpdatable.h"
+#include "Engine/World/ETickGroup.h"
+
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace TDME
+{
+    class TransformHierarchy;
+    class JobSystem;
+
+    /**
+     * @brief 같은 실제 타입의 객체들을 한 번에 Update 하는 함수 (타입별로 생성되어 가상 호출 없이 T::Update 를 직접 호출)
+     */
+    using TickBatchFunction = void (*)(IUpdatable* const* objects, uint32 count, float deltaTime);
+
+    /**
+     * @brief 병렬 Tick 구간이 끝난 뒤 메인 스레드에서 호출되는 함수 (Level 의 지연 명령 재생 등)
+     */
+    using TickSyncFunction = void (*)(void* context);
+
+    /**
+     * @brief 객체별 Tick 설정 (AActor / GActorComponent 가 멤버로 보유)
+     * @details 선행 조건 연결과 실행 위치(버킷 / 슬롯 인덱스 등)는 TickManager 의 레코드에 두고, 객체에는 설정과 레코드 인덱스만 보관.
+     *          레코드는 Update 를 재정의한 객체나 선행 조건으로 연결된 객체만 가지므로 Tick 하지 않는 컴포넌트는 레코드를 만들지 않음
+     */
+    struct TickState
+    {
+        static constexpr uint32 InvalidIndex = ~0u;
+
+        TickBatchFunction Function    = nullptr;                // 실제 타입의 일괄 Update (Update 를 재정의하지 않은 타입이면 nullptr 이며 Tick 하지 않음)
+        float             Interval    = 0.0f;                   // Tick 간격 (초, 0 이면 매 프레임)
+        uint32            RecordIndex = InvalidIndex;           // TickManager 의 레코드 인덱스 (레코드가 없으면 InvalidIndex)
+        ETickGroup        Group       = ETickGroup::PrePhysics; // 사용자 설정 Tick 그룹
+        bool              IsEnabled   = true;                   // 사용자 설정 (SetTickEnabled)
+        bool              IsParallel  = false;                  // 작업 스레드에서 Tick 가능 (SetTickInParallel)
+    };
+
+    /**
+     * @brief Tick 관리자
+     * @details Update 를 재정의한 Actor / 컴포넌트만 등록하고, Tick 그룹 → 선행 조건 깊이 → 실제 타입 버킷 순으로 묶어 Update.
+     * @li 버킷의 루프는 T::Update 를 한정 호출하므로 가상 호출 없이 직접 호출 (인라인 가능)
+     * @li Update 를 재정의하지 않은 객체(기본 빈 Update)는 등록 자체를 하지 않음
+     * @li Tick 활성화 / 비활성화 / 등록 해제는 목록의 맨 끝 항목과 교체 후 제거하므로 O(1). 비활성 객체는 순회하지 않음
+     * @li Tick 간격이 있는 객체는 별도 목록에 두고 경과 시간이 간격을 넘을 때만 누적 시간으로 Update (메인 스레드)
+     * @li Tick 그룹(ETickGroup)은 순서대로 실행되고, 같은 그룹 안에서는 선행 조건 깊이(단계) 순으로 실행
+     * @li 병렬 Tick 을 허용한 객체는 단계마다 JobSystem 의 ParallelFor 로 실행되고, 나머지는 그 뒤 메인 스레드에서 실행
+     * @li 선행 조건 연결과 실행 위치는 레코드 인덱스로 찾는 별도 테이블에 두어 Actor / 컴포넌트의 크기를 늘리지 않음
+     * @note Tick 도중의 등록 / 활성화 변경은 Tick 이 끝난 뒤 반영 (순회 중 목록이 바뀌지 않도록)
+     * @note 병렬 Tick 에서는 자신과 자신의 컴포넌트의 상태(로컬 트랜스폼 포함)만 변경할 것.
+     *       Actor 스폰 / 삭제, 부착 / 분리는 LevelCommandBuffer 에 기록하고(병렬 구간이 끝나면 재생), World Matrix 읽기와 Tick 설정 변경은 메인 스레드 Tick 에서만 수행
+     * @see TDME::Level, TDME::TickState, TDME::ETickGroup
+     */
+    class TickManager
+    {
+    public:
+        /**
+         * @brief Tick 관리자 생성
+         * @param transformHierarchy 병렬 Tick 동안 트랜스폼 변경 알림을 모아 둘 계층 구조 (nullptr 이면 사용하지 않음)
+         * @param jobSystem 병렬 Tick 에 사용할 작업 시스템 (nullptr 이면 모든 Tick 을 메인 스레드에서 실행)
+         */
+        explicit TickManager(TransformHierarchy* transformHierarchy = nullptr, JobSystem* jobSystem = nullptr);
+        ~TickManager();
+
+        TickManager(const TickManager&)            = delete;
+        TickManager& operator=(const TickManager&) = delete;
+
+        //////////////////////////////////////////////////////////////
+        // 등록
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 객체 등록 (Update 를 재정의하지 않았으면 레코드를 만들지 않고, 비활성이면 목록에 넣지 않음)
+         * @param state 객체의 Tick 설정 (Function 이 설정되어 있어야 함)
+         * @param object Update 를 호출할 객체
+         */
+        void Register(TickState& state, IUpdatable* object);
+
+        /**
+         * @brief 객체 등록 해제 (O(1) + 선행 조건 연결 수, Tick 도중에는 호출하지 말 것)
+         * @details 다른 객체와의 선행 조건 연결도 모두 끊고 레코드를 반환
+         * @param state 객체의 Tick 설정
+         */
+        void Unregister(TickState& state);
+
+        /**
+         * @brief IsEnabled / Interval / Group / IsParallel 변경 반영 (O(1), 실행 순서는 다음 Tick 에서 다시 계산)
+         * @param state 객체의 Tick 설정
+         */
+        void Refresh(TickState& state);
+
+        //////////////////////////////////////////////////////////////
+        // 선행 조건
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 선행 조건 추가 (state 는 prerequisite 의 Tick 이 끝난 뒤에 Tick)
+         * @details 둘 다 이 TickManager 에 등록된 객체여야 함. 순환이 생기면 순환을 이루는 간선 하나는 무시됨
+         * @param state 나중에 Tick 할 객체
+         * @param prerequisite 먼저 Tick 할 객체
+         */
+        void AddPrerequisite(TickState& state, TickState& prerequisite);
+
+        /**
+         * @brief 선행 조건 제거
+         * @param state 나중에 Tick 하던 객체
+         * @param prerequisite 먼저 Tick 하던 객체
+         */
+        void RemovePrerequisite(TickState& state, TickState& prerequisite);
+
+        //////////////////////////////////////////////////////////////
+        // Tick
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 등록된 객체 Update (Tick 그룹 → 선행 조건 단계 → 버킷 순)
+         * @param deltaTime 이전 프레임과의 시간 차이 (초)
+         */
+        void Tick(float deltaTime);
+
+        /**
+         * @brief 병렬 Tick 구간이 끝날 때마다(같은 단계의 메인 스레드 Tick 전에) 호출할 함수 설정
+         * @details 병렬 Tick 에서 기록한 구조 변경(스폰 / 삭제 / 부착)을 같은 단계의 메인 스레드 Tick 과 다음 단계가 보도록 하는 동기화 지점
+         * @param function 호출할 함수 (nullptr 이면 호출하지 않음)
+         * @param context 함수에 전달할 데이터
+         */
+        void SetSyncFunction(TickSyncFunction function, void* context);
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Tick 중인 객체 수 반환 (매 프레임 + 간격)
+         */
+        [[nodiscard]] uint32 GetTickingCount() const { return m_tickingCount; }
+
+        /**
+         * @brief 버킷(단계별 실제 타입) 수 반환
+         */
+        [[nodiscard]] uint32 GetBucketCount() const;
+
+        /**
+         * @brief 작업 시스템 반환 (없으면 nullptr)
+         */
+        [[nodiscard]] JobSystem* GetJobSystem() const { return m_jobSystem; }
+
+        /**
+         * @brief 타입 T 의 일괄 Update 함수 반환
+         * @tparam T 실제 타입
+         * @tparam Base Update 의 기본 구현을 가진 클래스 (AActor / GActorComponent)
+         * @return TickBatchFunction T 가 Update 를 재정의하지 않았으면 nullptr (Tick 불필요)
+         */
+        template <typename T, typename Base>
+        static TickBatchFunction GetTickFunction()
+        {
+            // T 에서 찾은 Update 가 Base 의 것이면 재정의하지 않은 것 (중간 상위 클래스가 재정의했으면 그 클래스의 멤버 포인터 타입이 됨)
+            if constexpr (std::is_same_v<decltype(&T::Update), void (Base::*)(float)>)
+            {
+                return nullptr;
+            }
+            else
+            {
+                return [](IUpdatable* const* objects, uint32 count, float deltaTime)
+                {
+                    for (uint32 i = 0; i < count; i++)
+                    {
+                        static_cast<T*>(objects[i])->T::Update(deltaTime);
+                    }
+                };
+            }
+        }
+
+    private:
+        /**
+         * @brief 레코드가 있는 객체의 선행 조건 연결과 실행 위치 (레코드 인덱스는 등록 해제 전까지 바뀌지 않음)
+         */
+        struct TickRecord
+        {
+            TickState*  State   = nullptr; // 객체의 Tick 설정
+            IUpdatable* Object  = nullptr; // Update 를 호출할 객체 (선행 조건 연결 때문에 만든 레코드면 Tick 하지 않으므로 nullptr 일 수 있음)
+            float       Elapsed = 0.0f;    // 마지막 Tick 이후 경과 시간 (간격이 있을 때만 사용)
+
+            // 선행 조건 (양방향으로 연결하여 어느 쪽이 등록 해제되어도 끊을 수 있도록 함)
+            std::vector<uint32> Prerequisites; // 이 객체보다 먼저 Tick 해야 하는 객체의 레코드
+            std::vector<uint32> Dependents;    // 이 객체를 선행 조건으로 가진 객체의 레코드
+
+            // 선행 조건으로 정해진 실행 순서 (선행 조건이 없으면 Group / 0)
+            ETickGroup EffectiveGroup = ETickGroup::PrePhysics; // 선행 조건이 더 늦은 그룹에 있으면 그 그룹으로 미뤄짐
+            uint32     Depth          = 0;                      // 같은 그룹 안에서 선행 조건 사슬의 길이 (깊이가 같은 객체끼리 동시에 실행)
+
+            // 현재 위치
+            ETickGroup PlacedGroup      = ETickGroup::PrePhysics;
+            uint32     PlacedDepth      = 0;
+            uint32     BucketIndex      = TickState::InvalidIndex;
+            uint32     SlotIndex        = TickState::InvalidIndex; // 버킷 목록 내 인덱스 (InvalidIndex 면 Tick 하지 않는 중)
+            uint32     LinkedIndex      = TickState::InvalidIndex; // 선행 조건이 있는 레코드 목록 내 인덱스
+            bool       IsInterval       = false;                   // 현재 간격 목록에 있는지
+            bool       IsInParallelList = false;                   // 현재 병렬 목록에 있는지
+            bool       IsQueued         = false;                   // Tick 도중 변경되어 Tick 이후 반영 대기 중
+            uint8      VisitState       = 0;                       // 실행 순서 계산 중 방문 상태 (순환 감지)
+        };
+
+        /**
+         * @brief 한 스레드 종류의 매 프레임 Tick 목록
+         */
+        struct TickList
+        {
+            std::vector<IUpdatable*> Objects; // 일괄 함수에 그대로 전달
+            std::vector<uint32>      Records; // Objects 와 인덱스가 같은 레코드 (교체 후 제거 시 슬롯 인덱스 갱신용)
+        };
+
+        /**
+         * @brief 실제 타입 하나의 Tick 목록
+         */
+        struct Bucket
+        {
+            TickBatchFunction   Function;
+            TickList            MainThread;      // 메인 스레드에서 Tick
+            TickList            Parallel;        // 작업 스레드에서 Tick
+            std::vector<uint32> IntervalRecords; // 간격이 있는 객체 (메인 스레드)
+        };
+
+        /**
+         * @brief 같은 Tick 그룹 / 선행 조건 깊이의 버킷 묶음 (단계 안의 객체끼리는 서로 독립)
+         */
+        struct Stage
+        {
+            std::vector<Bucket>                           Buckets;
+            std::unordered_map<TickBatchFunction, uint32> BucketIndices;
+        };
+
+        /**
+         * @brief 실행 순서 계산 중인 레코드와 다음에 확인할 선행 조건 인덱스
+         */
+        struct ResolveFrame
+        {
+            uint32 Record;
+            uint32 NextPrerequisite;
+        };
+
+        /**
+         * @brief 객체의 레코드 인덱스 반환 (없으면 생성)
+         */
+        uint32 AcquireRecord(TickState& state, IUpdatable* object);
+
+        /**
+         * @brief 레코드의 설정 변경 반영
+         */
+        void Refresh(uint32 index);
+
+        /**
+         * @brief 단계 하나의 Tick (병렬 목록 → 메인 스레드 목록 → 간격 목록)
+         */
+        void TickStage(Stage& stage, float deltaTime);
+
+        /**
+         * @brief 선행 조건이 있는 레코드의 Tick 그룹 / 깊이 재계산 후 위치 갱신
+         */
+        void RebuildOrder();
+
+        /**
+         * @brief 레코드 하나의 Tick 그룹 / 깊이 계산 (선행 조건부터 깊이 우선으로 계산, 순환을 이루는 간선은 무시)
+         */
+        void ResolveOrder(uint32 root);
+
+        /**
+         * @brief 현재 설정에 맞는 목록으로 위치 갱신
+         */
+        void UpdatePlacement(uint32 index);
+
+        /**
+         * @brief 선행 조건이 있는 레코드 목록에서 제거
+         */
+        void RemoveLinked(uint32 index);
+
+        /**
+         * @brief 버킷 목록에 추가
+         */
+        void Insert(uint32 index);
+
+        /**
+         * @brief 버킷 목록에서 제거 (맨 끝 항목과 교체 후 제거)
+         */
+        void Remove(uint32 index);
+
+        /**
+         * @brief 단계의 실제 타입 버킷 인덱스 반환 (없으면 생성)
+         */
+        static uint32 FindOrAddBucket(Stage& stage, TickBatchFunction function);
+
+        static constexpr uint32 MinParallelGrainSize = 256; // 병렬 청크의 최소 객체 수 (작은 버킷은 작업 스레드를 깨우지 않고 바로 실행)
+
+        TransformHierarchy* m_transformHierarchy;
+        JobSystem*          m_jobSystem;
+        TickSyncFunction    m_syncFunction = nullptr;
+        void*               m_syncContext  = nullptr;
+
+        std::vector<TickRecord>   m_records;                                        // 레코드 테이블 (TickState::RecordIndex 로 찾음)
+        std::vector<uint32>       m_freeRecords;                                    // 반환된 레코드 인덱스
+        std::vector<Stage>        m_stages[static_cast<size_t>(ETickGroup::Count)]; // [Tick 그룹][선행 조건 깊이]
+        std::vector<uint32>       m_linkedRecords;                                  // 선행 조건이 있는 레코드
+        std::vector<uint32>       m_queuedRecords;                                  // Tick 도중 변경된 레코드
+        std::vector<ResolveFrame> m_resolveStack;                                   // 실행 순서 계산용 스택 (할당을 재사용하도록 멤버로 보관)
+        uint32                    m_tickingCount = 0;
+        bool                      m_isTicking    = false;
+        bool                      m_isOrderDirty = false; // 선행 조건 / 그룹 변경으로 실행 순서 재계산 필요
+    };
+} // namespace TDME
\ No newline at end of file
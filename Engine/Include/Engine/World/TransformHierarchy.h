@@ -0,0 +1,259 @@
+#pragma once
+
+#include <Core/CoreTypes.h>
+#include <Core/Math/TMatrix3x4.h>
+
+#include <utility>
+#include <vector>
+
+namespace TDME
+{
+    class GSceneComponent;
+
+    /**
+     * @brief Level 단위 트랜스폼 계층 구조
+     * @details Level 에 등록된 SceneComponent 들을 부모가 항상 자식보다 앞에 오는 순서(위상 정렬)로 연속된 배열에 저장하고,
+     *          매 프레임 한 번의 선형 순회로 오래된 노드의 World Matrix 를 일괄 재계산.
+     * @li 부모의 World Matrix 는 항상 자식보다 먼저 계산되므로 재귀 호출 / 부모 체인 탐색이 필요 없음
+     * @li 노드마다 World 버전과 계산 시점의 부모 World 버전을 저장. 로컬 변경 또는 부모 버전 불일치인 노드만 재계산
+     * @li 새 노드는 배열 끝에 추가하고, 부착 / 분리는 부모 인덱스만 제자리에서 갱신 (부모가 자식보다 앞에 있는 한 순서가 유지됨).
+     *     부모가 자식보다 뒤에 오는 부착이나 Bake 대상이 바뀌는 변경만 다음 Update(또는 읽기) 에서 순서를 한 번에 재구성
+     * @li 등록 해제된 슬롯은 비워 두고, 빈 슬롯이 전체의 1/4 을 넘으면 재구성하면서 압축
+     * @li 자신과 모든 조상이 Static 인 노드는 배열 앞쪽 정적 영역에 모아 Bake 하고, 매 프레임 순회는 그 뒤부터 시작.
+     *     정적 영역은 연속 메모리이므로 렌더러가 그대로 묶어서(Batch) 사용할 수 있음
+     * @note Update 이전에 읽으면 해당 노드의 부모 체인 중 오래된 부분만 즉시 재계산 (Update 직후에는 O(1))
+     * @see TDME::GSceneComponent, TDME::Level
+     */
+    class TransformHierarchy
+    {
+    public:
+        TransformHierarchy();
+        ~TransformHierarchy();
+
+        TransformHierarchy(const TransformHierarchy&)            = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+        //////////////////////////////////////////////////////////////
+        // 노드 관리
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 컴포넌트 등록
+         * @details 배열 끝에 추가 (부모는 이미 앞에 있으므로 순서 유지). 먼저 등록된 자식이 있거나 Bake 대상이면 순서 재구성을 예약.
+         *          이미 다른 계층 구조에 등록되어 있으면 무시
+         * @param component 등록할 컴포넌트
+         */
+        void Register(GSceneComponent* component);
+
+        /**
+         * @brief 노드 count 개를 더 등록할 용량 확보 (대량 스폰 전에 호출하여 배열이 등록마다 다시 할당되지 않도록)
+         * @param count 추가로 등록할 노드 수
+         */
+        void Reserve(uint32 count);
+
+        /**
+         * @brief 컴포넌트 등록 해제
+         * @details 슬롯만 비움 (빈 슬롯이 많아지거나 정적 영역의 노드면 다음 Update 에서 재구성하면서 압축)
+         * @param component 등록 해제할 컴포넌트
+         */
+        void Unregister(GSceneComponent* component);
+
+        /**
+         * @brief 부모 변경 알림 (부착 / 분리 후 호출)
+         * @details 부모가 앞에 있으면 부모 인덱스만 제자리에서 갱신 (O(서브트리)). 부모가 뒤에 있거나 Bake 대상이 바뀌면 순서 재구성을 예약
+         * @param component 부모가 바뀐 등록된 컴포넌트
+         */
+        void NotifyParentChanged(GSceneComponent* component);
+
+        /**
+         * @brief Mobility 변경 알림 (Bake 대상이 바뀔 때만 순서 재구성을 예약)
+         * @param component Mobility 가 바뀐 등록된 컴포넌트
+         */
+        void NotifyMobilityChanged(GSceneComponent* component);
+
+        /**
+         * @brief 노드의 로컬 트랜스폼 변경 알림 (O(1))
+         * @details 자손 노드는 부모 World 버전이 바뀐 것을 보고 Update(또는 읽기) 시점에 재계산됨
+         * @param index 노드 인덱스
+         */
+        void MarkDirty(uint32 index)
+        {
+            m_dirtyFlags[index] = 1;
+            if (m_isDeferringChanges)
+                return; // 병렬 구간: 노드별 플래그만 설정하고 공유 상태는 EndDeferredChanges 에서 갱신
+
+            m_hasPendingChanges = true;
+            m_changeEpoch++;
+
+            if (index < m_staticCount)
+            {
+                m_isStaticDirty = true; // Bake 된 노드가 움직임: 다음 Update 에서 정적 영역 재 Bake
+            }
+        }
+
+        /**
+         * @brief 병렬 구간 시작 (메인 스레드에서 호출)
+         * @details 구간 동안 MarkDirty 는 노드의 변경 플래그만 설정하므로 여러 작업 스레드가 서로 다른 노드의 로컬 트랜스폼을 동시에 바꿀 수 있음
+         * @note 구간 동안에는 World Matrix 를 읽거나 부착 / 분리 등 구조를 바꾸지 말 것
+         * @see TDME::TickManager
+         */
+        void BeginDeferredChanges() { m_isDeferringChanges = true; }
+
+        /**
+         * @brief 병렬 구간 종료 (구간 동안 미룬 변경 알림을 한 번에 반영, 메인 스레드에서 호출)
+         */
+        void EndDeferredChanges();
+
+        /**
+         * @brief 병렬 구간 중인지 여부
+         */
+        [[nodiscard]] bool IsDeferringChanges() const { return m_isDeferringChanges; }
+
+        //////////////////////////////////////////////////////////////
+        // 갱신
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 오래된 노드의 World Matrix 일괄 재계산
+         * @details 구조가 바뀌었으면 먼저 위상 정렬 순서를 재구성한 뒤, 정적 영역 이후부터 배열을 한 번 순회
+         *          (정적 영역은 Bake 된 노드가 바뀌었을 때만 다시 순회)
+         */
+        void Update();
+
+        //////////////////////////////////////////////////////////////
+        // Getter
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 컴포넌트의 최신 World Matrix 반환
+         * @details 마지막 Update 이후 변경이 없으면 O(1). 변경이 있으면 부모 체인 중 오래된 부분만 재계산
+         * @param component 등록된 컴포넌트
+         */
+        [[nodiscard]] const Matrix3x4& GetWorldMatrix(const GSceneComponent* component);
+
+        /**
+         * @brief 컴포넌트의 최신 World 버전 반환 (필요하면 GetWorldMatrix 와 같이 재계산)
+         * @param component 등록된 컴포넌트
+         */
+        [[nodiscard]] uint32 GetWorldVersion(const GSceneComponent* component);
+
+        /**
+         * @brief 재계산 없이 노드의 현재 World 버전 반환 (O(1))
+         * @param index 노드 인덱스
+         */
+        [[nodiscard]] uint32 PeekWorldVersion(uint32 index) const { return m_worldVersions[index]; }
+
+        /**
+         * @brief 컴포넌트의 World Matrix 가 Bake 되었는지 여부 (정적 영역에 속함)
+         * @param component 등록된 컴포넌트
+         */
+        [[nodiscard]] bool IsBaked(const GSceneComponent* component);
+
+        /**
+         * @brief 등록된 노드 수 반환 (등록 해제 후 압축 전의 빈 슬롯 포함)
+         */
+        [[nodiscard]] uint32 GetNodeCount() const { return static_cast<uint32>(m_components.size()); }
+
+        //////////////////////////////////////////////////////////////
+        // 정적 영역 (렌더러 정적 배치용, Update 이후 유효)
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Bake 된 노드 수 반환 (배열 앞쪽 [0, GetStaticNodeCount()) 구간)
+         */
+        [[nodiscard]] uint32 GetStaticNodeCount() const { return m_staticCount; }
+
+        /**
+         * @brief Bake 된 컴포넌트 배열 반환 (GetStaticNodeCount() 개)
+         */
+        [[nodiscard]] GSceneComponent* const* GetStaticComponents() const { return m_components.data(); }
+
+        /**
+         * @brief Bake 된 World Matrix 배열 반환 (GetStaticNodeCount() 개, 연속 메모리)
+         */
+        [[nodiscard]] const Matrix3x4* GetStaticWorldMatrices() const { return m_worldMatrices.data(); }
+
+        /**
+         * @brief 정적 영역 버전 반환
+         * @details 정적 영역의 구성이나 Bake 된 값이 바뀔 때마다 증가. 렌더러는 이 값이 같으면 이전에 만든 정적 배치를 재사용
+         */
+        [[nodiscard]] uint32 GetStaticVersion() const { return m_staticVersion; }
+
+    private:
+        /**
+         * @brief 다음 Update(또는 읽기) 에서 순서 재구성 예약
+         */
+        void MarkStructureDirty()
+        {
+            m_isStructureDirty  = true;
+            m_hasPendingChanges = true;
+        }
+
+        /**
+         * @brief 루트부터 깊이 우선으로 순회하여 부모가 자식보다 앞에 오도록 배열을 재구성 (빈 슬롯 제거)
+         */
+        void RebuildOrder();
+
+        /**
+         * @brief 컴포넌트가 정적 영역에 있어야 하는지 여부 (자신이 Static 이고 부모가 없거나 Bake 된 부모)
+         */
+        bool ShouldBake(const GSceneComponent* component) const;
+
+        /**
+         * @brief 노드의 부모 인덱스를 현재 부모로 갱신하고, 외부 부모 플래그가 바뀌었으면 서브트리에 전파
+         * @param index 노드 인덱스 (부모가 이 계층 구조에 있으면 부모가 앞에 있어야 함)
+         */
+        void RelinkSubtree(uint32 index);
+
+        /**
+         * @brief 노드 하나가 오래되었으면 World Matrix 재계산 (부모는 최신이라고 가정)
+         * @param index 노드 인덱스
+         * @return bool 재계산 여부
+         */
+        bool UpdateNode(uint32 index);
+
+        /**
+         * @brief 노드의 부모 체인을 위에서부터 최신 상태로 만듦 (재귀 없이 스택 사용)
+         * @param index 노드 인덱스
+         */
+        void ResolveNode(uint32 index);
+
+        /**
+         * @brief 컴포넌트를 지연 계산 경로로 되돌림 (World 버전은 이어서 증가하도록 넘겨줌)
+         * @param index 노드 인덱스
+         */
+        void ReleaseNode(uint32 index);
+
+        static constexpr int32 InvalidIndex = -1;
+
+        // 인덱스가 같은 요소끼리 한 노드 (위상 정렬 순서)
+        std::vector<GSceneComponent*> m_components;
+        std::vector<int32>            m_parentIndices; // 부모 노드 인덱스 (루트 또는 다른 계층 구조의 부모면 InvalidIndex)
+        std::vector<Matrix3x4>        m_worldMatrices;
+        std::vector<uint32>           m_worldVersions;    // World Matrix 가 재계산될 때마다 증가
+        std::vector<uint32>           m_parentVersions;   // 계산 시점의 부모 World 버전 (부모가 없으면 0)
+        std::vector<uint32>           m_verifiedEpochs;   // 마지막으로 최신임을 확인한 시점의 m_changeEpoch
+        std::vector<uint8>            m_dirtyFlags;       // 로컬 트랜스폼 변경 여부
+        std::vector<uint8>            m_externalFlags;    // 조상 중에 다른 계층 구조(또는 미등록) 부모가 있으면 1 (변경 알림을 받을 수 없음)
+        std::vector<uint32>           m_resolveStack;     // ResolveNode 용 임시 스택
+
+        // 순서 재구성 / 서브트리 갱신용 임시 배열 (재구성할 때마다 할당하지 않도록 보관, 재구성 후 이전 배열과 교환)
+        std::vector<std::pair<GSceneComponent*, bool>> m_orderStack;
+        std::vector<GSceneComponent*>                  m_orderedComponents;
+        std::vector<GSceneComponent*>                  m_dynamicComponents;
+        std::vector<GSceneComponent*>                  m_relinkStack;
+        std::vector<Matrix3x4>                         m_scratchWorldMatrices;
+        std::vector<uint32>                            m_scratchWorldVersions;
+        std::vector<uint32>                            m_scratchParentVersions;
+        std::vector<uint8>                             m_scratchDirtyFlags;
+
+        uint32 m_emptySlotCount     = 0;     // 등록 해제로 비워진 슬롯 수 (재구성 시 압축)
+        uint32 m_changeEpoch        = 1;     // MarkDirty / 순서 재구성 시 증가
+        uint32 m_staticCount        = 0;     // 배열 앞쪽 정적(Bake) 영역의 노드 수
+        uint32 m_staticVersion      = 0;     // 정적 영역이 바뀔 때마다 증가
+        bool   m_isStructureDirty   = false;
+        bool   m_hasPendingChanges  = false; // 마지막 Update 이후 변경 여부
+        bool   m_isStaticDirty      = false; // 정적 영역 재 Bake 필요 여부
+        bool   m_isDeferringChanges = false; // 병렬 구간 중 (MarkDirty 가 공유 상태를 바꾸지 않음)
+    };
+} // namespace TDME
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Level.h"
+#include "ObjectHandleTable.h"
+#include <Core/Async/JobSystem.h>
 #include <memory>
 
 namespace TDME
@@ -8,6 +10,8 @@ namespace TDME
     /**
      * @brief World: 게임 월드
      * @details Level 을 소유하고 게임 루프를 관리.
+     * @li 객체 핸들 테이블을 소유하며 모든 Level 이 공유 (Level 이 바뀌어도 같은 ID 체계로 객체 조회)
+     * @li 작업 시스템(JobSystem)을 소유하며 Level 의 병렬 Tick 등에 사용
      */
     class World
     {
@@ -53,13 +57,65 @@ namespace TDME
             return m_persistentLevel->SpawnActor<T>(std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief 같은 타입의 Actor 여러 개를 한꺼번에 생성 (Level 에 위임)
+         * @see TDME::Level::SpawnActors
+         */
+        template <typename T, typename InitFunc>
+        void SpawnActors(uint32 count, InitFunc&& init, bool isParallelBeginPlay = false)
+        {
+            m_persistentLevel->SpawnActors<T>(count, std::forward<InitFunc>(init), isParallelBeginPlay);
+        }
+
+        /**
+         * @brief 같은 타입의 Actor 여러 개를 한꺼번에 생성 (초기화 없음, Level 에 위임)
+         */
+        template <typename T>
+        void SpawnActors(uint32 count)
+        {
+            m_persistentLevel->SpawnActors<T>(count);
+        }
+
         /**
          * @brief Actor 파괴 (Level 에 위임)
          * @param actor 파괴할 Actor
          */
         void DestroyActor(AActor* actor);
 
+        //////////////////////////////////////////////////////////////
+        // 객체 조회
+        //////////////////////////////////////////////////////////////
+
+        /**
+         * @brief 객체 핸들 테이블 반환
+         */
+        [[nodiscard]] ObjectHandleTable& GetHandleTable() { return m_handleTable; }
+
+        /**
+         * @brief 작업 시스템 반환 (Level Tick 외에 컬링 / 메시 생성 / 리소스 디코드 등도 이 시스템에 작업을 넣음)
+         */
+        [[nodiscard]] JobSystem& GetJobSystem() { return m_jobSystem; }
+
+        /**
+         * @brief 객체 ID 로 객체 조회 (O(1), 삭제된 객체면 nullptr)
+         * @param id 객체 ID
+         */
+        [[nodiscard]] GameObject* FindObject(ObjectID id) const { return m_handleTable.Find(id); }
+
+        /**
+         * @brief 핸들이 가리키는 객체 반환 (O(1), 삭제되었거나 T 가 아니면 nullptr)
+         * @tparam T 핸들 타입
+         * @param handle 객체 핸들
+         */
+        template <typename T>
+        [[nodiscard]] T* Resolve(ObjectHandle<T> handle) const
+        {
+            return m_handleTable.Resolve(handle);
+        }
+
     private:
+        ObjectHandleTable      m_handleTable; // Level 보다 먼저 선언 (Level 이 소멸하며 등록 해제하므로 나중에 소멸해야 함)
+        JobSystem              m_jobSystem;   // Level 보다 먼저 선언 (Level 의 Tick 이 사용)
         std::unique_ptr<Level> m_persistentLevel;
     };
 } // namespace TDME
\ No newline at end of file
@@ -5,11 +5,15 @@
 #include <Core/Math/Transform.h>
 
 #include "Engine/Object/Component/GSceneComponent.h"
+#include "Engine/World/Level.h"
+#include "Engine/World/ObjectHandleTable.h"
+#include "Engine/World/TransformHierarchy.h"
+
+#include <algorithm>
 
 namespace TDME
 {
     static const Transform s_defaultTransform; // Root Component가 없을 경우 기본 트랜스폼 (위치, 회전, 스케일 없음)
-    static const Matrix    s_identityMatrix = Matrix::Identity();
 
     AActor::AActor()
         : GameObject(), m_rootComponent(nullptr), m_components()
@@ -22,6 +26,125 @@ namespace TDME
         m_rootComponent = nullptr;
     }
 
+    void AActor::RegisterToLevel(Level* level)
+    {
+        m_level = level;
+        m_level->GetHandleTable().Register(this);
+        m_level->GetTickManager().Register(m_tick, this);
+
+        for (TPooledPtr<GActorComponent>& component : m_components)
+        {
+            RegisterComponentToLevel(component.get());
+        }
+    }
+
+    void AActor::UnregisterFromLevel()
+    {
+        if (!m_level)
+            return;
+
+        ObjectHandleTable& handleTable = m_level->GetHandleTable();
+        TickManager&       tickManager = m_level->GetTickManager();
+        for (TPooledPtr<GActorComponent>& component : m_components)
+        {
+            handleTable.Unregister(component.get());
+            tickManager.Unregister(component->m_tick);
+        }
+        handleTable.Unregister(this);
+        tickManager.Unregister(m_tick);
+
+        m_level = nullptr;
+    }
+
+    void AActor::RegisterComponentToLevel(GActorComponent* component)
+    {
+        m_level->GetHandleTable().Register(component);
+        m_level->GetTickManager().Register(component->m_tick, component);
+
+        if (GSceneComponent* sceneComponent = Cast<GSceneComponent>(component))
+        {
+            m_level->GetTransformHierarchy().Register(sceneComponent);
+        }
+    }
+
+    void AActor::SetTickEnabled(bool enabled)
+    {
+        m_tick.IsEnabled = enabled;
+        RefreshTick();
+    }
+
+    void AActor::SetTickInterval(float interval)
+    {
+        m_tick.Interval = interval > 0.0f ? interval : 0.0f;
+        RefreshTick();
+    }
+
+    void AActor::SetTickGroup(ETickGroup group)
+    {
+        m_tick.Group = group;
+        RefreshTick();
+    }
+
+    void AActor::SetTickInParallel(bool isParallel)
+    {
+        m_tick.IsParallel = isParallel;
+        RefreshTick();
+    }
+
+    void AActor::AddTickPrerequisite(AActor* prerequisite)
+    {
+        // 선행 조건 연결은 Level 의 TickManager 가 보관하므로 같은 Level 에 등록된 Actor 끼리만 연결
+        if (!prerequisite || !m_level || prerequisite->m_level != m_level)
+            return;
+
+        m_level->GetTickManager().AddPrerequisite(m_tick, prerequisite->m_tick);
+    }
+
+    void AActor::RemoveTickPrerequisite(AActor* prerequisite)
+    {
+        if (!prerequisite || !m_level || prerequisite->m_level != m_level)
+            return;
+
+        m_level->GetTickManager().RemovePrerequisite(m_tick, prerequisite->m_tick);
+    }
+
+    void AActor::RefreshTick()
+    {
+        if (m_level)
+        {
+            m_level->GetTickManager().Refresh(m_tick);
+        }
+    }
+
+    void AActor::RegisterComponentType(ComponentTypeID typeID, GActorComponent* component)
+    {
+        auto it = std::lower_bound(m_componentTypeRanges.begin(), m_componentTypeRanges.end(), typeID,
+                                   [](const ComponentTypeRange& range, ComponentTypeID id) { return range.TypeID < id; });
+
+        // 1. 구간이 없으면 정렬 위치에 빈 구간 생성 (다음 구간의 시작 위치에서 시작)
+        if (it == m_componentTypeRanges.end() || it->TypeID != typeID)
+        {
+            const uint32 begin = (it == m_componentTypeRanges.end()) ? static_cast<uint32>(m_componentsByType.size()) : it->Begin;
+            it                 = m_componentTypeRanges.insert(it, ComponentTypeRange{ typeID, begin, 0 });
+        }
+
+        // 2. 구간 끝에 삽입하고 뒤쪽 구간의 시작 위치를 한 칸씩 이동 (추가된 순서 유지)
+        m_componentsByType.insert(m_componentsByType.begin() + (it->Begin + it->Count), component);
+        it->Count++;
+
+        for (auto next = it + 1; next != m_componentTypeRanges.end(); ++next)
+        {
+            next->Begin++;
+        }
+    }
+
+    const AActor::ComponentTypeRange* AActor::FindComponentTypeRange(ComponentTypeID typeID) const
+    {
+        auto it = std::lower_bound(m_componentTypeRanges.begin(), m_componentTypeRanges.end(), typeID,
+                                   [](const ComponentTypeRange& range, ComponentTypeID id) { return range.TypeID < id; });
+        return (it != m_componentTypeRanges.end() && it->TypeID == typeID) ? &*it : nullptr;
+    }
+
     const Transform& AActor::GetTransform() const
     {
         if (m_rootComponent)
@@ -31,12 +154,12 @@ namespace TDME
         return s_defaultTransform;
     }
 
-    const Matrix& AActor::GetWorldMatrix() const
+    Matrix AActor::GetWorldMatrix() const
     {
         if (m_rootComponent)
         {
             return m_rootComponent->GetWorldMatrix();
         }
-        return s_identityMatrix;
+        return Matrix::Identity();
     }
 } // namespace TDME
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "pch.h"
+#include "Engine/Object/ClassInfo.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace TDME
+{
+    ClassInfo*        ClassInfo::s_registeredHead  = nullptr;
+    uint32            ClassInfo::s_classCount      = 0;
+    std::atomic<bool> ClassInfo::s_isRegistryDirty = false;
+
+    static std::mutex s_registryMutex; // 레지스트리 계산 (상수 초기화되므로 정적 초기화 순서와 무관)
+
+    ClassInfo::ClassInfo(const char* name, SuperClassGetter superClassGetter)
+        : m_name(name), m_typeID(HashName(name)), m_superClassGetter(superClassGetter)
+    {
+        m_nextRegistered = s_registeredHead;
+        m_isRegistered   = true;
+
+        s_registeredHead = this;
+        s_classCount++;
+        s_isRegistryDirty.store(true, std::memory_order_release);
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Getter
+    //////////////////////////////////////////////////////////////
+
+    const ClassInfo* ClassInfo::GetSuperClass() const
+    {
+        BuildRegistry();
+        return m_superClass;
+    }
+
+    uint32 ClassInfo::GetClassIndex() const
+    {
+        BuildRegistry();
+        return m_classIndex;
+    }
+
+    uint32 ClassInfo::GetSubtreeSize() const
+    {
+        BuildRegistry();
+        return m_subtreeSize;
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 레지스트리
+    //////////////////////////////////////////////////////////////
+
+    void ClassInfo::BuildRegistry()
+    {
+        if (!s_isRegistryDirty.load(std::memory_order_acquire))
+            return;
+
+        // 여러 스레드가 동시에 처음 조회하면 한 스레드만 계산하고 나머지는 잠금에서 기다린 뒤 바로 반환
+        std::lock_guard<std::mutex> lock(s_registryMutex);
+        if (!s_isRegistryDirty.load(std::memory_order_relaxed))
+            return;
+
+        // 1. 상위 클래스 연결 (상위 클래스가 아직 생성되지 않았으면 등록될 때 다시 구성되므로 이번에는 제외)
+        std::vector<ClassInfo*> classes;
+        classes.reserve(s_classCount);
+        for (ClassInfo* info = s_registeredHead; info; info = info->m_nextRegistered)
+        {
+            const ClassInfo* super = info->m_superClassGetter ? &info->m_superClassGetter() : nullptr;
+
+            info->m_superClass  = (super && super->m_isRegistered) ? super : nullptr;
+            info->m_classIndex  = InvalidIndex;
+            info->m_subtreeSize = 0;
+            classes.push_back(info);
+        }
+
+        // 2. 정적 초기화 순서와 무관하게 같은 번호가 나오도록 이름순 정렬 (같은 상위 클래스의 자식끼리 이 순서로 방문)
+        std::sort(classes.begin(), classes.end(), [](const ClassInfo* lhs, const ClassInfo* rhs) { return std::strcmp(lhs->m_name, rhs->m_name) < 0; });
+
+        //    타입 ID 중복 검사 (컴포넌트 타입 ID 도 같은 이름 해시이므로 함께 검사. 다른 네임스페이스의 같은 이름이나 해시 충돌이면 클래스 이름을 바꿀 것)
+        std::vector<NameHash> typeIDs;
+        typeIDs.reserve(classes.size());
+        for (const ClassInfo* info : classes)
+        {
+            typeIDs.push_back(info->m_typeID);
+        }
+        std::sort(typeIDs.begin(), typeIDs.end());
+        TDME_ASSERT(std::adjacent_find(typeIDs.begin(), typeIDs.end()) == typeIDs.end(), "Duplicate class type ID (same class name or name hash collision)");
+
+        // 3. 최상위 클래스부터 깊이 우선 순회하여 전위 순회 번호 부여
+        //    자식은 아직 번호가 없는 클래스 중 상위 클래스가 현재 노드인 것 (클래스 수가 적고 한 번만 수행하므로 인접 리스트를 따로 만들지 않음)
+        std::vector<ClassInfo*> stack;
+        uint32                  nextIndex = 0;
+        for (ClassInfo* root : classes)
+        {
+            if (root->m_superClassGetter)
+                continue; // 최상위 클래스(GameObject)만 시작점 (상위 클래스가 아직 없는 클래스는 번호 없이 남김)
+
+            root->m_classIndex = nextIndex++;
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                ClassInfo* node  = stack.back();
+                ClassInfo* child = nullptr;
+                for (ClassInfo* candidate : classes)
+                {
+                    if (candidate->m_superClass == node && candidate->m_classIndex == InvalidIndex)
+                    {
+                        child = candidate;
+                        break;
+                    }
+                }
+
+                if (child)
+                {
+                    child->m_classIndex = nextIndex++;
+                    stack.push_back(child);
+                }
+                else
+                {
+                    // 모든 자식을 방문했으므로 서브트리 크기 확정
+                    node->m_subtreeSize = nextIndex - node->m_classIndex;
+                    stack.pop_back();
+                }
+            }
+        }
+
+        s_isRegistryDirty.store(false, std::memory_order_release);
+    }
+} // namespace TDME
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Engine/Object/Component/GActorComponent.h"
 
 #include "Engine/Object/Actor/AActor.h"
+#include "Engine/World/Level.h"
 
 namespace TDME
 {
@@ -24,4 +25,36 @@ namespace TDME
     {
         m_owner = nullptr;
     }
+
+    void GActorComponent::SetTickEnabled(bool enabled)
+    {
+        m_tick.IsEnabled = enabled;
+        RefreshTick();
+    }
+
+    void GActorComponent::SetTickInterval(float interval)
+    {
+        m_tick.Interval = interval > 0.0f ? interval : 0.0f;
+        RefreshTick();
+    }
+
+    void GActorComponent::SetTickGroup(ETickGroup group)
+    {
+        m_tick.Group = group;
+        RefreshTick();
+    }
+
+    void GActorComponent::SetTickInParallel(bool isParallel)
+    {
+        m_tick.IsParallel = isParallel;
+        RefreshTick();
+    }
+
+    void GActorComponent::RefreshTick()
+    {
+        if (m_owner && m_owner->GetLevel())
+        {
+            m_owner->GetLevel()->GetTickManager().Refresh(m_tick);
+        }
+    }
 } // namespace TDME
\ No newline at end of file
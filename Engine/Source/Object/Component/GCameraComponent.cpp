@@ -47,4 +47,41 @@ namespace TDME
         SetRotation((m_transform.Rotation * rollRotation).Normalized());
     }
 
+    //////////////////////////////////////////////////////////////
+    // 행렬
+    //////////////////////////////////////////////////////////////
+
+    const Matrix& GCameraComponent::GetViewMatrix() const
+    {
+        const uint32 worldVersion = GetWorldVersion();
+        if (m_cachedViewWorldVersion != worldVersion)
+        {
+            m_cachedView             = GetWorldMatrix3x4().Inverse().ToMatrix();
+            m_cachedViewWorldVersion = worldVersion;
+        }
+        return m_cachedView;
+    }
+
+    const Matrix& GCameraComponent::GetProjectionMatrix() const
+    {
+        if (m_isProjectionDirty)
+        {
+            m_cachedProjection  = PerspectiveFovLH(m_fovY, m_aspectRatio, m_nearZ, m_farZ);
+            m_isProjectionDirty = false;
+        }
+        return m_cachedProjection;
+    }
+
+    const Matrix& GCameraComponent::GetViewProjectionMatrix() const
+    {
+        const uint32 worldVersion = GetWorldVersion();
+        if (m_isViewProjectionDirty || m_cachedViewProjWorldVersion != worldVersion)
+        {
+            m_cachedViewProjection       = GetViewMatrix() * GetProjectionMatrix();
+            m_cachedViewProjWorldVersion = worldVersion;
+            m_isViewProjectionDirty      = false;
+        }
+        return m_cachedViewProjection;
+    }
+
 } // namespace TDME
\ No newline at end of file
@@ -1,12 +1,17 @@
 #include "pch.h"
+#include <Core/Math/TMatrix3x4.h>
 #include <Core/Math/TMatrix4x4.h>
 #include <Core/Math/TVector3.h>
 #include "Engine/Object/Component/GSceneComponent.h"
+#include "Engine/World/TransformHierarchy.h"
 
 namespace TDME
 {
+    uint32                               GSceneComponent::s_changeEpoch = 1;
+    std::vector<const GSceneComponent*> GSceneComponent::s_resolveStack;
+
     GSceneComponent::GSceneComponent()
-        : GActorComponent(), m_transform(), m_parent(nullptr), m_children()
+        : GActorComponent(), m_transform()
     {
     }
 
@@ -14,13 +19,29 @@ namespace TDME
     {
         DetachFromParent();
 
-        // 자식들의 부모 참조 제거
-        for (GSceneComponent* child : m_children)
+        if (m_hierarchy)
         {
-            if (child)
-                child->m_parent = nullptr;
+            m_hierarchy->Unregister(this);
         }
-        m_children.clear();
+
+        // 자식들의 부모 참조 제거 (부모가 사라졌으므로 자식의 World Matrix 캐시 무효화)
+        GSceneComponent* child = m_firstChild;
+        while (child)
+        {
+            GSceneComponent* next = child->m_nextSibling;
+
+            child->m_parent      = nullptr;
+            child->m_prevSibling = nullptr;
+            child->m_nextSibling = nullptr;
+            if (child->m_hierarchy)
+            {
+                child->m_hierarchy->NotifyParentChanged(child);
+            }
+            child->SetTransformDirty();
+
+            child = next;
+        }
+        m_firstChild = nullptr;
     }
 
     void GSceneComponent::AttachToComponent(GSceneComponent* parent)
@@ -33,7 +54,26 @@ namespace TDME
         m_parent = parent;
         if (m_parent)
         {
-            m_parent->m_children.push_back(this);
+            // 부모의 자식 리스트 끝에 연결 (첫 번째 자식의 m_prevSibling 이 마지막 자식)
+            GSceneComponent* first = m_parent->m_firstChild;
+            if (first)
+            {
+                GSceneComponent* last = first->m_prevSibling;
+                last->m_nextSibling   = this;
+                m_prevSibling         = last;
+                first->m_prevSibling  = this;
+            }
+            else
+            {
+                m_parent->m_firstChild = this;
+                m_prevSibling          = this;
+            }
+            m_nextSibling = nullptr;
+        }
+
+        if (m_hierarchy)
+        {
+            m_hierarchy->NotifyParentChanged(this);
         }
 
         SetTransformDirty(); // 부모 컴포넌트 변경 시 World Matrix 캐시 무효화
@@ -43,9 +83,33 @@ namespace TDME
     {
         if (m_parent)
         {
-            std::vector<GSceneComponent*>& parentChildren = m_parent->m_children;
-            parentChildren.erase(std::remove(parentChildren.begin(), parentChildren.end(), this), parentChildren.end());
-            m_parent = nullptr;
+            // 형제 리스트에서 자신을 떼어냄
+            if (m_parent->m_firstChild == this)
+            {
+                m_parent->m_firstChild = m_nextSibling;
+            }
+            else
+            {
+                m_prevSibling->m_nextSibling = m_nextSibling;
+            }
+
+            if (m_nextSibling)
+            {
+                m_nextSibling->m_prevSibling = m_prevSibling;
+            }
+            else if (m_parent->m_firstChild)
+            {
+                m_parent->m_firstChild->m_prevSibling = m_prevSibling; // 마지막 자식이 빠졌으므로 새 마지막 자식 기록
+            }
+
+            m_parent      = nullptr;
+            m_prevSibling = nullptr;
+            m_nextSibling = nullptr;
+
+            if (m_hierarchy)
+            {
+                m_hierarchy->NotifyParentChanged(this);
+            }
 
             SetTransformDirty(); // 부모에서 분리되었으므로 World Matrix 캐시 무효화
         }
@@ -55,6 +119,24 @@ namespace TDME
     // Getter / Setter
     //////////////////////////////////////////////////////////////
 
+    void GSceneComponent::SetMobility(EComponentMobility mobility)
+    {
+        if (m_mobility == mobility)
+            return;
+
+        m_mobility = mobility;
+
+        if (m_hierarchy)
+        {
+            m_hierarchy->NotifyMobilityChanged(this); // Bake 대상이 바뀌면 재구분
+        }
+    }
+
+    bool GSceneComponent::IsWorldMatrixBaked() const
+    {
+        return m_hierarchy && m_hierarchy->IsBaked(this);
+    }
+
     void GSceneComponent::SetTransform(const Transform& transform)
     {
         m_transform = transform;
@@ -63,11 +145,17 @@ namespace TDME
 
     void GSceneComponent::SetTransformDirty()
     {
-        if (!m_isDirty)
+        // 자신의 버전만 올림 (자손은 읽을 때 부모 World 버전 불일치로 재계산)
+        m_localVersion++;
+
+        if (m_hierarchy)
         {
-            m_isDirty = true;
-            PropagateDirtyFlagToChildren();
+            m_hierarchy->MarkDirty(m_hierarchyIndex);
+            if (m_hierarchy->IsDeferringChanges())
+                return; // 병렬 Tick 중: 전역 변경 카운터는 구간이 끝날 때 한 번만 증가 (작업 스레드끼리 공유 변수를 쓰지 않도록)
         }
+
+        s_changeEpoch++;
     }
 
     void GSceneComponent::SetPosition(const Vector3& position)
@@ -88,64 +176,97 @@ namespace TDME
         SetTransformDirty();
     }
 
-    const Matrix& GSceneComponent::GetWorldMatrix() const
+    Matrix GSceneComponent::GetWorldMatrix() const
     {
-        if (m_isDirty)
+        return GetWorldMatrix3x4().ToMatrix();
+    }
+
+    const Matrix3x4& GSceneComponent::GetWorldMatrix3x4() const
+    {
+        if (m_hierarchy)
         {
-            RecalculateWorldMatrix();
+            return m_hierarchy->GetWorldMatrix(this);
         }
+
+        ResolveWorldMatrix();
         return m_cachedWorldMatrix;
     }
 
+    uint32 GSceneComponent::GetWorldVersion() const
+    {
+        if (m_hierarchy)
+        {
+            return m_hierarchy->GetWorldVersion(this);
+        }
+
+        ResolveWorldMatrix();
+        return m_worldVersion;
+    }
+
     Vector3 GSceneComponent::GetForwardVector() const
     {
-        const Matrix& world = GetWorldMatrix();
-        return Vector3(world.Zx, world.Zy, world.Zz).Normalized();
+        return GetWorldMatrix3x4().GetAxisZ().Normalized();
     }
 
     Vector3 GSceneComponent::GetUpVector() const
     {
-        const Matrix& world = GetWorldMatrix();
-        return Vector3(world.Yx, world.Yy, world.Yz).Normalized();
+        return GetWorldMatrix3x4().GetAxisY().Normalized();
     }
 
     Vector3 GSceneComponent::GetRightVector() const
     {
-        const Matrix& world = GetWorldMatrix();
-        return Vector3(world.Xx, world.Xy, world.Xz).Normalized();
+        return GetWorldMatrix3x4().GetAxisX().Normalized();
     }
 
     //////////////////////////////////////////////////////////////
     // Private Functions
     //////////////////////////////////////////////////////////////
 
-    void GSceneComponent::PropagateDirtyFlagToChildren()
+    uint32 GSceneComponent::PeekWorldVersion() const
     {
-        for (GSceneComponent* child : m_children)
-        {
-            if (child && !child->m_isDirty)
-            {
-                child->m_isDirty = true;
-                child->PropagateDirtyFlagToChildren();
-            }
-        }
+        return m_hierarchy ? m_hierarchy->PeekWorldVersion(m_hierarchyIndex) : m_worldVersion;
     }
 
-    void GSceneComponent::RecalculateWorldMatrix() const
+    void GSceneComponent::ResolveWorldMatrix() const
     {
-        Matrix localMatrix = m_transform.ToMatrix();
+        if (m_verifiedEpoch == s_changeEpoch)
+            return;
 
-        if (m_parent)
+        // 1. 마지막 변경 이후 이미 확인한 조상 또는 계층 구조에 등록된 조상을 만날 때까지 부모 체인을 수집
+        //    등록된 부모를 거쳐 다시 호출될 수 있으므로 스택은 base 위쪽만 사용
+        const size_t           base = s_resolveStack.size();
+        const GSceneComponent* node = this;
+        while (node && !node->m_hierarchy && node->m_verifiedEpoch != s_changeEpoch)
         {
-            // Local Matrix x Parent World Matrix (부모가 Dirty Flag면 부모도 재계산 후 캐시 반환)
-            m_cachedWorldMatrix = localMatrix * m_parent->GetWorldMatrix();
+            s_resolveStack.push_back(node);
+            node = node->m_parent;
         }
-        else
+
+        // 2. 위에서부터 오래된 캐시만 재계산 (부모 체인 길이만큼만 확인, 자손은 건드리지 않음)
+        for (size_t i = s_resolveStack.size(); i > base; i--)
         {
-            m_cachedWorldMatrix = localMatrix;
+            s_resolveStack[i - 1]->UpdateCachedWorldMatrix();
         }
+        s_resolveStack.resize(base);
+    }
+
+    void GSceneComponent::UpdateCachedWorldMatrix() const
+    {
+        const Matrix3x4* parentWorld   = m_parent ? &m_parent->GetWorldMatrix3x4() : nullptr;
+        const uint32     parentVersion = m_parent ? m_parent->PeekWorldVersion() : 0;
+
+        m_verifiedEpoch = s_changeEpoch;
+
+        if (m_cachedLocalVersion == m_localVersion && m_cachedParentVersion == parentVersion)
+            return;
+
+        const Matrix3x4 localMatrix = m_transform.ToMatrix3x4();
 
-        m_isDirty = false;
+        // Local Matrix x Parent World Matrix
+        m_cachedWorldMatrix   = parentWorld ? localMatrix * *parentWorld : localMatrix;
+        m_cachedLocalVersion  = m_localVersion;
+        m_cachedParentVersion = parentVersion;
+        m_worldVersion++;
     }
 
 } // namespace TDME
\ No newline at end of file
@@ -3,10 +3,8 @@
 
 namespace TDME
 {
-    uint32 GameObject::s_nextObjectID = 1;
-
     GameObject::GameObject()
-        : m_objectID(s_nextObjectID++), m_name()
+        : m_objectID(InvalidObjectID), m_name()
     {
     }
 } // namespace TDME
\ No newline at end of file
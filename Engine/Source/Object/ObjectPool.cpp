@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "Engine/Object/ObjectPool.h"
+
+#include <algorithm>
+
+namespace TDME
+{
+    ObjectPool* ObjectPool::s_poolHead = nullptr;
+
+    ObjectPool::ObjectPool(const char* typeName, size_t slotSize, size_t slotAlignment)
+        : m_typeName(typeName),
+          m_slotSize(std::max(slotSize, sizeof(FreeSlot))),
+          m_slotAlignment(std::max(slotAlignment, alignof(FreeSlot)))
+    {
+        // 슬롯 크기를 정렬 단위로 올림하여 청크 안의 모든 슬롯이 정렬되도록 함
+        m_slotSize      = (m_slotSize + m_slotAlignment - 1) / m_slotAlignment * m_slotAlignment;
+        m_slotsPerChunk = std::max(MinSlotsPerChunk, static_cast<uint32>(ChunkByteSize / m_slotSize));
+
+        m_nextPool = s_poolHead;
+        s_poolHead = this;
+    }
+
+    ObjectPool::~ObjectPool()
+    {
+        // 아직 살아 있는 객체가 있으면 청크를 해제하지 않음 (해당 객체가 나중에 소멸할 때 해제된 메모리에 접근하지 않도록)
+        if (m_liveCount == 0)
+        {
+            for (void* chunk : m_chunks)
+            {
+                ::operator delete(chunk, std::align_val_t(m_slotAlignment));
+            }
+        }
+
+        // 전역 풀 목록에서 제거
+        for (ObjectPool** link = &s_poolHead; *link; link = &(*link)->m_nextPool)
+        {
+            if (*link == this)
+            {
+                *link = m_nextPool;
+                break;
+            }
+        }
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 할당 / 해제
+    //////////////////////////////////////////////////////////////
+
+    void* ObjectPool::Allocate()
+    {
+        if (!m_freeList)
+        {
+            AllocateChunk(m_slotsPerChunk);
+        }
+
+        FreeSlot* slot = m_freeList;
+        m_freeList     = slot->Next;
+        m_liveCount++;
+        return slot;
+    }
+
+    void ObjectPool::Deallocate(void* slot)
+    {
+        FreeSlot* freeSlot = static_cast<FreeSlot*>(slot);
+        freeSlot->Next     = m_freeList;
+        m_freeList         = freeSlot;
+        m_liveCount--;
+    }
+
+    void ObjectPool::Reserve(uint32 count)
+    {
+        const uint32 freeCount = m_slotCount - m_liveCount;
+        if (freeCount >= count)
+            return;
+
+        AllocateChunk(std::max(count - freeCount, m_slotsPerChunk));
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 통계
+    //////////////////////////////////////////////////////////////
+
+    ObjectPoolStats ObjectPool::GetStats() const
+    {
+        ObjectPoolStats stats;
+        stats.TypeName   = m_typeName;
+        stats.SlotSize   = static_cast<uint32>(m_slotSize);
+        stats.LiveCount  = m_liveCount;
+        stats.SlotCount  = m_slotCount;
+        stats.ChunkCount = static_cast<uint32>(m_chunks.size());
+        return stats;
+    }
+
+    void ObjectPool::CollectStats(std::vector<ObjectPoolStats>& outStats)
+    {
+        for (const ObjectPool* pool = s_poolHead; pool; pool = pool->m_nextPool)
+        {
+            outStats.push_back(pool->GetStats());
+        }
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Private
+    //////////////////////////////////////////////////////////////
+
+    void ObjectPool::AllocateChunk(uint32 slotCount)
+    {
+        std::byte* chunk = static_cast<std::byte*>(::operator new(m_slotSize * slotCount, std::align_val_t(m_slotAlignment)));
+        m_chunks.push_back(chunk);
+        m_slotCount += slotCount;
+
+        // 앞쪽 슬롯부터 할당되도록 뒤에서부터 Free List 에 추가 (같은 청크 안에서 주소 순서대로 채워짐)
+        for (uint32 i = slotCount; i > 0; i--)
+        {
+            FreeSlot* slot = reinterpret_cast<FreeSlot*>(chunk + (i - 1) * m_slotSize);
+            slot->Next     = m_freeList;
+            m_freeList     = slot;
+        }
+    }
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "pch.h"
+#include "Engine/Renderer/Shape/ProceduralMesh.h"
+
+#include <Core/Math/MathUtils.h>
+
+namespace TDME
+{
+    namespace ProceduralMesh
+    {
+        //////////////////////////////////////////////////////////////
+        // 미리 생성된 LOD 조회
+        //////////////////////////////////////////////////////////////
+
+        bool FindUnitSphere(uint32 stacks, uint32 slices, SphereMeshView& outView)
+        {
+            if (stacks == 8 && slices == 16)
+                outView = GetView(UnitSphere<8, 16>);
+            else if (stacks == 16 && slices == 32)
+                outView = GetView(UnitSphere<16, 32>);
+            else if (stacks == 32 && slices == 64)
+                outView = GetView(UnitSphere<32, 64>);
+            else
+                return false;
+
+            return true;
+        }
+
+        bool FindUnitCircle(uint32 segments, CircleMeshView& outView)
+        {
+            if (segments == 16)
+                outView = GetView(UnitCircle<16>);
+            else if (segments == 32)
+                outView = GetView(UnitCircle<32>);
+            else if (segments == 64)
+                outView = GetView(UnitCircle<64>);
+            else
+                return false;
+
+            return true;
+        }
+
+        //////////////////////////////////////////////////////////////
+        // 런타임 생성
+        //////////////////////////////////////////////////////////////
+
+        void BuildUnitSphere(uint32 stacks, uint32 slices, std::vector<VertexPT>& outVertices, std::vector<uint16>& outIndices)
+        {
+            // 위도(phi: 0 ~ π) / 경도(theta: 0 ~ 2π) 테이블
+            std::vector<float> sinPhi(stacks + 1), cosPhi(stacks + 1);
+            std::vector<float> sinTheta(slices + 1), cosTheta(slices + 1);
+            Math::SinCosTable(Math::Pi, stacks, sinPhi.data(), cosPhi.data());
+            Math::SinCosTable(Math::Pi2, slices, sinTheta.data(), cosTheta.data());
+
+            outVertices.clear();
+            outVertices.reserve((stacks + 1) * (slices + 1));
+
+            for (uint32 i = 0; i <= stacks; i++)
+            {
+                for (uint32 j = 0; j <= slices; j++)
+                {
+                    Vector3 position(sinPhi[i] * cosTheta[j], cosPhi[i], sinPhi[i] * sinTheta[j]);
+                    Vector2 uv(
+                        static_cast<float>(j) / static_cast<float>(slices), // U: 0->1 (경도)
+                        static_cast<float>(i) / static_cast<float>(stacks)  // V: 0->1 (위도)
+                    );
+
+                    outVertices.emplace_back(position, uv);
+                }
+            }
+
+            const uint32 indexCount = stacks * slices * 6;
+            outIndices.resize(indexCount);
+
+            for (uint32 i = 0; i < indexCount; i++)
+            {
+                outIndices[i] = MakeSphereIndex(i, slices);
+            }
+        }
+
+        void BuildUnitCircle(uint32 segments, std::vector<Vector2>& outPoints)
+        {
+            std::vector<float> sinTable(segments + 1), cosTable(segments + 1);
+            Math::SinCosTable(Math::Pi2, segments, sinTable.data(), cosTable.data());
+
+            outPoints.clear();
+            outPoints.reserve(segments + 1);
+
+            for (uint32 i = 0; i <= segments; i++)
+            {
+                outPoints.emplace_back(cosTable[i], sinTable[i]);
+            }
+        }
+    } // namespace ProceduralMesh
+} // namespace TDME
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "Engine/RHI/IRHIDevice.h"
 #include "Engine/RHI/IRHIContext.h"
 #include "Engine/Renderer/IRenderer.h"
+#include "Engine/Renderer/Shape/ProceduralMesh.h"
 #include "Engine/Renderer/VertexTypes.h"
 
 namespace TDME
@@ -110,14 +111,18 @@ namespace TDME
         // 중심점
         vertices.emplace_back(0.0f, 0.0f, color32);
 
-        // 원 각 점들 (로컬 좌표)
-        float angleStep = Math::Pi2 / static_cast<float>(segments);
-        for (size_t i = 0; i <= segments; i++)
+        // 원 각 점들 (로컬 좌표): 자주 쓰는 분할 수는 컴파일 타임 테이블, 나머지만 런타임 생성
+        std::vector<Vector2>           runtimePoints;
+        ProceduralMesh::CircleMeshView circle;
+        if (!ProceduralMesh::FindUnitCircle(segments, circle))
         {
-            float angle = angleStep * i;
-            float x     = radius * std::cos(angle);
-            float y     = radius * std::sin(angle);
-            vertices.emplace_back(x, y, color32);
+            ProceduralMesh::BuildUnitCircle(segments, runtimePoints);
+            circle = { runtimePoints.data(), static_cast<uint32>(runtimePoints.size()) };
+        }
+
+        for (uint32 i = 0; i < circle.PointCount; i++)
+        {
+            vertices.emplace_back(radius * circle.Points[i].X, radius * circle.Points[i].Y, color32);
         }
 
         m_renderer->SetWorldMatrix(worldMatrix);
@@ -10,9 +10,10 @@
 #include "Engine/RHI/IRHIContext.h"
 #include "Engine/RHI/Pipeline/IPipelineState.h"
 #include "Engine/Renderer/IRenderer.h"
+#include "Engine/Renderer/Shape/ProceduralMesh.h"
 #include "Engine/Renderer/VertexTypes.h"
 
-#include <cmath>
+#include <vector>
 
 namespace TDME
 {
@@ -42,43 +43,23 @@ namespace TDME
     {
         Color32 color32 = Color32::FromColor(color);
 
+        // 단위 구: 자주 쓰는 LOD 는 컴파일 타임 테이블, 나머지만 런타임 생성
+        std::vector<VertexPT>          runtimeVertices;
+        std::vector<uint16>            runtimeIndices;
+        ProceduralMesh::SphereMeshView sphere;
+        if (!ProceduralMesh::FindUnitSphere(stacks, slices, sphere))
+        {
+            ProceduralMesh::BuildUnitSphere(stacks, slices, runtimeVertices, runtimeIndices);
+            sphere = { runtimeVertices.data(), runtimeIndices.data(), static_cast<uint32>(runtimeVertices.size()), static_cast<uint32>(runtimeIndices.size()) };
+        }
+
+        // 인덱스 순서대로 삼각형 리스트로 펼침 (반지름 적용, 삼각함수 호출 없음)
         std::vector<VertexPC> vertices;
-        vertices.reserve(stacks * slices * 6);
+        vertices.reserve(sphere.IndexCount);
 
-        for (uint32 i = 0; i < stacks; i++)
+        for (uint32 i = 0; i < sphere.IndexCount; i++)
         {
-            // 현재 stack과 다음 stack의 각도
-            float phi0 = Math::Pi * static_cast<float>(i) / static_cast<float>(stacks);
-            float phi1 = Math::Pi * static_cast<float>(i + 1) / static_cast<float>(stacks);
-
-            float sinPhi0 = std::sin(phi0), sinPhi1 = std::sin(phi1);
-            float cosPhi0 = std::cos(phi0), cosPhi1 = std::cos(phi1);
-
-            for (uint32 j = 0; j < slices; j++)
-            {
-                // 현재 slice와 다음 slice의 각도
-                float theta0 = Math::Pi2 * static_cast<float>(j) / static_cast<float>(slices);
-                float theta1 = Math::Pi2 * static_cast<float>(j + 1) / static_cast<float>(slices);
-
-                float sinTheta0 = std::sin(theta0), sinTheta1 = std::sin(theta1);
-                float cosTheta0 = std::cos(theta0), cosTheta1 = std::cos(theta1);
-
-                // 4개의 정점 (Quad)
-                Vector3 v00(radius * sinPhi0 * cosTheta0, radius * cosPhi0, radius * sinPhi0 * sinTheta0); // 좌상 (i, j)
-                Vector3 v01(radius * sinPhi0 * cosTheta1, radius * cosPhi0, radius * sinPhi0 * sinTheta1); // 우상 (i, j+1)
-                Vector3 v10(radius * sinPhi1 * cosTheta0, radius * cosPhi1, radius * sinPhi1 * sinTheta0); // 좌하 (i+1, j)
-                Vector3 v11(radius * sinPhi1 * cosTheta1, radius * cosPhi1, radius * sinPhi1 * sinTheta1); // 우하 (i+1, j+1)
-
-                // Triangle 1: v00 -> v01 -> v10
-                vertices.emplace_back(v00, color32);
-                vertices.emplace_back(v01, color32);
-                vertices.emplace_back(v10, color32);
-
-                // Triangle 2: v01 -> v11 -> v10
-                vertices.emplace_back(v01, color32);
-                vertices.emplace_back(v11, color32);
-                vertices.emplace_back(v10, color32);
-            }
+            vertices.emplace_back(sphere.Vertices[sphere.Indices[i]].Position * radius, color32);
         }
 
         m_renderer->SetWorldMatrix(worldMatrix);
@@ -115,75 +96,34 @@ namespace TDME
         if (m_sphereVB && m_sphereIB && m_cachedStacks == stacks && m_cachedSlices == slices)
             return;
 
-        // 1. 정점 생성 (단위 구, radius = 1)
-        const uint32          vertexCount = (stacks + 1) * (slices + 1);
-        std::vector<VertexPT> vertices;
-        vertices.reserve(vertexCount);
-
-        for (uint32 i = 0; i <= stacks; i++)
+        // 1. 단위 구 (radius = 1): 자주 쓰는 LOD 는 컴파일 타임 테이블을 그대로 업로드
+        std::vector<VertexPT>          runtimeVertices;
+        std::vector<uint16>            runtimeIndices;
+        ProceduralMesh::SphereMeshView sphere;
+        if (!ProceduralMesh::FindUnitSphere(stacks, slices, sphere))
         {
-            float phi    = Math::Pi * static_cast<float>(i) / static_cast<float>(stacks);
-            float sinPhi = std::sin(phi);
-            float cosPhi = std::cos(phi);
-
-            for (uint32 j = 0; j <= slices; j++)
-            {
-                float theta    = Math::Pi2 * static_cast<float>(j) / static_cast<float>(slices);
-                float sinTheta = std::sin(theta);
-                float cosTheta = std::cos(theta);
-
-                Vector3 position(sinPhi * cosTheta, cosPhi, sinPhi * sinTheta);
-                Vector2 uv(
-                    static_cast<float>(j) / static_cast<float>(slices), // U: 0->1 (경도)
-                    static_cast<float>(i) / static_cast<float>(stacks)  // V: 0->1 (위도)
-                );
-
-                vertices.emplace_back(position, uv);
-            }
+            ProceduralMesh::BuildUnitSphere(stacks, slices, runtimeVertices, runtimeIndices);
+            sphere = { runtimeVertices.data(), runtimeIndices.data(), static_cast<uint32>(runtimeVertices.size()), static_cast<uint32>(runtimeIndices.size()) };
         }
 
-        // 2. 인덱스 생성
-        m_indexCount = stacks * slices * 6;
-        std::vector<uint16> indices;
-        indices.reserve(m_indexCount);
-
-        for (uint32 i = 0; i < stacks; i++)
-        {
-            for (uint32 j = 0; j < slices; j++)
-            {
-                uint16 topLeft     = static_cast<uint16>(i * (slices + 1) + j);
-                uint16 topRight    = static_cast<uint16>(i * (slices + 1) + j + 1);
-                uint16 bottomLeft  = static_cast<uint16>((i + 1) * (slices + 1) + j);
-                uint16 bottomRight = static_cast<uint16>((i + 1) * (slices + 1) + j + 1);
-
-                // 삼각형 1: topLeft -> topRight -> bottomLeft
-                indices.push_back(topLeft);
-                indices.push_back(topRight);
-                indices.push_back(bottomLeft);
-
-                // 삼각형 2: topRight -> bottomRight -> bottomLeft
-                indices.push_back(topRight);
-                indices.push_back(bottomRight);
-                indices.push_back(bottomLeft);
-            }
-        }
+        m_indexCount = sphere.IndexCount;
 
-        // 3. GPU 버퍼 생성
+        // 2. GPU 버퍼 생성
         BufferDesc vbDesc;
         vbDesc.Type     = EBufferType::Vertex;
         vbDesc.Usage    = EBufferUsage::Default;
-        vbDesc.ByteSize = static_cast<uint32>(vertices.size() * sizeof(VertexPT));
+        vbDesc.ByteSize = sphere.VertexCount * static_cast<uint32>(sizeof(VertexPT));
         vbDesc.Stride   = sizeof(VertexPT);
 
-        m_sphereVB = m_device->CreateBuffer(vbDesc, vertices.data());
+        m_sphereVB = m_device->CreateBuffer(vbDesc, sphere.Vertices);
 
         BufferDesc ibDesc;
         ibDesc.Type     = EBufferType::Index;
         ibDesc.Usage    = EBufferUsage::Default;
-        ibDesc.ByteSize = static_cast<uint32>(indices.size() * sizeof(uint16));
+        ibDesc.ByteSize = sphere.IndexCount * static_cast<uint32>(sizeof(uint16));
         ibDesc.Stride   = sizeof(uint16);
 
-        m_sphereIB = m_device->CreateBuffer(ibDesc, indices.data());
+        m_sphereIB = m_device->CreateBuffer(ibDesc, sphere.Indices);
 
         m_cachedStacks = stacks;
         m_cachedSlices = slices;
@@ -1,20 +1,40 @@
 #include "pch.h"
 #include "Engine/World/Level.h"
 
-#include "Engine/Object/IRenderable.h"
 #include "Engine/Object/Actor/AActor.h"
+#include "Engine/World/LevelCommandBuffer.h"
+
+#include <Core/Async/JobSystem.h>
 
 #include <algorithm>
 #include <memory>
 
 namespace TDME
 {
-    Level::Level() = default;
+    Level::Level(ObjectHandleTable* handleTable, JobSystem* jobSystem)
+        : m_tickManager(&m_transformHierarchy, jobSystem),
+          m_ownedHandleTable(handleTable ? nullptr : std::make_unique<ObjectHandleTable>()),
+          m_handleTable(handleTable ? handleTable : m_ownedHandleTable.get()),
+          m_jobSystem(jobSystem)
+    {
+        // 작업 시스템의 스레드 인덱스마다 기록 버퍼 하나 (기록할 때 잠금 없음)
+        const uint32 threadCount = jobSystem ? jobSystem->GetThreadCount() : 1;
+        for (uint32 i = 0; i < threadCount; i++)
+        {
+            m_commandBuffers.push_back(std::make_unique<LevelCommandBuffer>());
+            m_playbackBuffers.push_back(std::make_unique<LevelCommandBuffer>());
+        }
+
+        // 병렬 Tick 구간이 끝날 때마다 기록된 명령 재생
+        m_tickManager.SetSyncFunction([](void* context) { static_cast<Level*>(context)->FlushCommands(); }, this);
+    }
+
     Level::~Level()
     {
-        for (std::unique_ptr<AActor>& actor : m_actors)
+        for (TPooledPtr<AActor>& actor : m_actors)
         {
             actor->EndPlay();
+            actor->UnregisterFromLevel(); // World 의 핸들 테이블은 Level 보다 오래 살아 있으므로 ID 무효화
         }
     }
 
@@ -22,20 +42,21 @@ namespace TDME
     {
         FlushPendingDestroy();
 
-        for (std::unique_ptr<AActor>& actor : m_actors)
-        {
-            actor->Update(deltaTime);
-        }
+        // Update 를 재정의한 Actor / 컴포넌트만 Tick 그룹 / 선행 조건 순서대로 실제 타입별 일괄 호출 (Tick 비활성 / 기본 Update 인 객체는 순회하지 않음)
+        m_tickManager.Tick(deltaTime);
+
+        // Tick 밖의 병렬 작업에서 기록된 명령 재생 (병렬 Tick 의 명령은 Tick 도중 이미 재생됨)
+        FlushCommands();
+
+        // Actor Update 에서 변경된 트랜스폼을 한 번에 반영 (Render 전에 World Matrix 확정)
+        m_transformHierarchy.Update();
     }
 
     void Level::Render()
     {
-        for (std::unique_ptr<AActor>& actor : m_actors)
+        for (IRenderable* renderable : m_renderables)
         {
-            if (IRenderable* renderable = dynamic_cast<IRenderable*>(actor.get()))
-            {
-                renderable->Render();
-            }
+            renderable->Render();
         }
     }
 
@@ -45,14 +66,63 @@ namespace TDME
 
     void Level::DestroyActor(AActor* actor)
     {
-        if (!actor)
+        // 다른 Level 의 Actor 이거나 이미 예약된 Actor 면 무시 (플래그로 확인하므로 목록을 탐색하지 않음)
+        if (!actor || actor->m_level != this || actor->m_isPendingDestroy)
             return;
 
-        // 중복 등록 방지
-        auto it = std::find(m_pendingDestroy.begin(), m_pendingDestroy.end(), actor);
-        if (it == m_pendingDestroy.end())
+        actor->m_isPendingDestroy = true;
+        m_pendingDestroy.push_back(actor);
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 지연 명령
+    //////////////////////////////////////////////////////////////
+
+    LevelCommandBuffer& Level::GetCommandBuffer()
+    {
+        // 작업 시스템이 없거나 등록되지 않은 스레드(작업 시스템을 만든 스레드가 아닌 메인 스레드)는 0 번 버퍼
+        const uint32 threadIndex = m_jobSystem ? m_jobSystem->GetCurrentThreadIndex() : 0;
+        return *m_commandBuffers[threadIndex < m_commandBuffers.size() ? threadIndex : 0];
+    }
+
+    void Level::FlushCommands()
+    {
+        // 1. 기록 버퍼를 재생 버퍼와 교환 (재생 중에 기록되는 명령은 다음 동기화 지점에서 재생)
+        m_commandEntries.clear();
+        for (uint32 bufferIndex = 0; bufferIndex < m_commandBuffers.size(); bufferIndex++)
         {
-            m_pendingDestroy.push_back(actor);
+            if (m_commandBuffers[bufferIndex]->IsEmpty())
+                continue;
+
+            LevelCommandBuffer& buffer = *m_playbackBuffers[bufferIndex];
+            buffer.Swap(*m_commandBuffers[bufferIndex]);
+            for (uint32 commandIndex = 0; commandIndex < buffer.GetCommandCount(); commandIndex++)
+            {
+                m_commandEntries.push_back({ buffer.m_commands[commandIndex].SortKey, bufferIndex, commandIndex });
+            }
+        }
+
+        if (m_commandEntries.empty())
+            return;
+
+        // 2. 정렬 키 순으로 재생 (같은 키는 한 스레드에서 기록되므로 버퍼 안의 기록 순서가 유지됨)
+        std::sort(m_commandEntries.begin(), m_commandEntries.end(), [](const CommandEntry& a, const CommandEntry& b)
+        {
+            if (a.SortKey != b.SortKey)
+                return a.SortKey < b.SortKey;
+            if (a.BufferIndex != b.BufferIndex)
+                return a.BufferIndex < b.BufferIndex;
+            return a.CommandIndex < b.CommandIndex;
+        });
+
+        for (const CommandEntry& entry : m_commandEntries)
+        {
+            m_playbackBuffers[entry.BufferIndex]->Execute(*this, entry.CommandIndex);
+        }
+
+        for (std::unique_ptr<LevelCommandBuffer>& buffer : m_playbackBuffers)
+        {
+            buffer->Clear();
         }
     }
 
@@ -65,21 +135,51 @@ namespace TDME
         if (m_pendingDestroy.empty())
             return;
 
-        // 1. EndPlay 호출
+        // 1. EndPlay 호출 및 객체 ID 무효화 (이후 핸들 조회는 nullptr)
+        //    EndPlay 에서 다른 Actor 를 삭제 예약할 수 있으므로 인덱스로 순회하여 이번에 함께 처리
+        for (size_t i = 0; i < m_pendingDestroy.size(); i++)
+        {
+            m_pendingDestroy[i]->EndPlay();
+        }
+
+        // 2. 목록에서 제거하고 삭제 (소멸된 Actor / 컴포넌트의 슬롯은 각 타입의 풀로 반환되어 재사용)
         for (AActor* actor : m_pendingDestroy)
         {
-            actor->EndPlay();
+            RemoveActor(actor);
         }
+        m_pendingDestroy.clear();
+    }
 
-        // 2. erase remove 패턴으로 일괄 제거
-        auto newEnd = std::remove_if(m_actors.begin(), m_actors.end(),
-                                     [this](const std::unique_ptr<AActor>& owned)
-                                     {
-                                         return m_pendingDestroy.end() != std::find(m_pendingDestroy.begin(), m_pendingDestroy.end(), owned.get());
-                                     });
+    void Level::RemoveActor(AActor* actor)
+    {
+        actor->UnregisterFromLevel();
 
-        m_actors.erase(newEnd, m_actors.end());
-        m_pendingDestroy.clear();
+        // 1. 렌더 목록에서 제거 (맨 끝 항목을 빈 자리로 옮기고 인덱스 갱신)
+        const uint32 renderableIndex = actor->m_renderableIndex;
+        if (renderableIndex != AActor::InvalidLevelIndex)
+        {
+            const uint32 last = static_cast<uint32>(m_renderables.size()) - 1;
+            if (renderableIndex != last)
+            {
+                m_renderables[renderableIndex]                         = m_renderables[last];
+                m_renderableOwners[renderableIndex]                    = m_renderableOwners[last];
+                m_renderableOwners[renderableIndex]->m_renderableIndex = renderableIndex;
+            }
+            m_renderables.pop_back();
+            m_renderableOwners.pop_back();
+        }
+
+        // 2. Actor 목록에서 제거 (소유권을 꺼낸 뒤 맨 끝 Actor 를 빈 자리로 옮김, 이 함수가 끝나면 삭제됨)
+        const uint32       actorIndex = actor->m_levelIndex;
+        TPooledPtr<AActor> removed    = std::move(m_actors[actorIndex]);
+
+        const uint32 last = static_cast<uint32>(m_actors.size()) - 1;
+        if (actorIndex != last)
+        {
+            m_actors[actorIndex]               = std::move(m_actors[last]);
+            m_actors[actorIndex]->m_levelIndex = actorIndex;
+        }
+        m_actors.pop_back();
     }
 
 } // namespace TDME
\ No newline at end of file
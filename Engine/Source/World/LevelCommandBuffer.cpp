@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "Engine/World/LevelCommandBuffer.h"
+
+#include "Engine/Object/Actor/AActor.h"
+#include "Engine/Object/Component/GSceneComponent.h"
+
+namespace TDME
+{
+    //////////////////////////////////////////////////////////////
+    // 기록
+    //////////////////////////////////////////////////////////////
+
+    void LevelCommandBuffer::DestroyActor(ObjectID sortKey, const AActor* actor)
+    {
+        if (!actor)
+            return;
+
+        AddCommand(ELevelCommandType::DestroyActor, sortKey).Target = actor->GetObjectID();
+    }
+
+    void LevelCommandBuffer::AttachComponent(ObjectID sortKey, const GSceneComponent* child, const GSceneComponent* parent)
+    {
+        if (!child || !parent)
+            return;
+
+        Command& command = AddCommand(ELevelCommandType::AttachComponent, sortKey);
+        command.Target   = child->GetObjectID();
+        command.Parent   = parent->GetObjectID();
+    }
+
+    void LevelCommandBuffer::DetachComponent(ObjectID sortKey, const GSceneComponent* child)
+    {
+        if (!child)
+            return;
+
+        AddCommand(ELevelCommandType::DetachComponent, sortKey).Target = child->GetObjectID();
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Private
+    //////////////////////////////////////////////////////////////
+
+    LevelCommandBuffer::Command& LevelCommandBuffer::AddCommand(ELevelCommandType type, ObjectID sortKey)
+    {
+        Command& command = m_commands.emplace_back();
+        command.Type     = type;
+        command.SortKey  = sortKey;
+        return command;
+    }
+
+    void LevelCommandBuffer::Execute(Level& level, uint32 index) const
+    {
+        const Command& command = m_commands[index];
+        switch (command.Type)
+        {
+        case ELevelCommandType::SpawnActor:
+            command.Spawn(level, m_payload.data() + command.PayloadOffset);
+            break;
+
+        case ELevelCommandType::DestroyActor:
+            level.DestroyActor(level.Resolve(ObjectHandle<AActor>(command.Target)));
+            break;
+
+        case ELevelCommandType::AttachComponent:
+        {
+            // 재생 전에 둘 중 하나라도 삭제되었으면 무시
+            GSceneComponent* child  = level.Resolve(ObjectHandle<GSceneComponent>(command.Target));
+            GSceneComponent* parent = level.Resolve(ObjectHandle<GSceneComponent>(command.Parent));
+            if (child && parent)
+            {
+                child->AttachToComponent(parent);
+            }
+            break;
+        }
+
+        case ELevelCommandType::DetachComponent:
+            if (GSceneComponent* child = level.Resolve(ObjectHandle<GSceneComponent>(command.Target)))
+            {
+                child->DetachFromParent();
+            }
+            break;
+        }
+    }
+
+    void LevelCommandBuffer::Clear()
+    {
+        m_commands.clear();
+        m_payload.clear();
+    }
+
+    void LevelCommandBuffer::Swap(LevelCommandBuffer& other)
+    {
+        m_commands.swap(other.m_commands);
+        m_payload.swap(other.m_payload);
+    }
+} // namespace TDME
\ No newline at end of file
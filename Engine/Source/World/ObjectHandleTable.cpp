@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "Engine/World/ObjectHandleTable.h"
+
+#include <algorithm>
+
+namespace TDME
+{
+    ObjectHandleTable::ObjectHandleTable() = default;
+
+    ObjectHandleTable::~ObjectHandleTable() = default;
+
+    //////////////////////////////////////////////////////////////
+    // 등록
+    //////////////////////////////////////////////////////////////
+
+    ObjectID ObjectHandleTable::Register(GameObject* object)
+    {
+        if (!object)
+            return InvalidObjectID;
+
+        if (Find(object->m_objectID) == object)
+            return object->m_objectID;
+
+        // 1. 빈 슬롯 재사용 (세대는 등록 해제 시 이미 올려 둠), 없으면 새 슬롯 추가
+        uint32 index;
+        if (m_freeHead != InvalidIndex)
+        {
+            index      = m_freeHead;
+            m_freeHead = m_slots[index].NextFree;
+        }
+        else
+        {
+            index = static_cast<uint32>(m_slots.size());
+            m_slots.push_back(Slot{ nullptr, 1, InvalidIndex });
+        }
+
+        // 2. 객체 ID 발급
+        Slot& slot         = m_slots[index];
+        slot.Object        = object;
+        slot.NextFree      = InvalidIndex;
+        object->m_objectID = MakeObjectID(index, slot.Generation);
+
+        m_liveCount++;
+        return object->m_objectID;
+    }
+
+    void ObjectHandleTable::Reserve(uint32 count)
+    {
+        // 작은 묶음으로 여러 번 호출해도 재할당이 누적되지 않도록 최소 두 배로 늘림
+        const size_t required = m_slots.size() + count;
+        if (required > m_slots.capacity())
+        {
+            m_slots.reserve(std::max(required, m_slots.capacity() * 2));
+        }
+    }
+
+    void ObjectHandleTable::Unregister(GameObject* object)
+    {
+        if (!object || Find(object->m_objectID) != object)
+            return;
+
+        const uint32 index = GetObjectIndex(object->m_objectID);
+        Slot&        slot  = m_slots[index];
+
+        // 세대를 올려 이전 ID 를 무효화 (0 은 InvalidObjectID 와 겹치지 않도록 건너뜀)
+        slot.Object = nullptr;
+        slot.Generation++;
+        if (slot.Generation == 0)
+        {
+            slot.Generation = 1;
+        }
+
+        slot.NextFree      = m_freeHead;
+        m_freeHead         = index;
+        object->m_objectID = InvalidObjectID;
+
+        m_liveCount--;
+    }
+} // namespace TDME
\ No newline at end of file
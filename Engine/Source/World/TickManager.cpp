@@ -0,0 +1,541 @@
+#include "pch.h"
+#include "Engine/World/TickManager.h"
+
+#include <Core/Async/JobSystem.h>
+
+#include "Engine/World/TransformHierarchy.h"
+
+#include <algorithm>
+
+namespace TDME
+{
+    namespace
+    {
+        constexpr uint8 VisitNone     = 0;
+        constexpr uint8 VisitActive   = 1; // 계산 중 (다시 만나면 순환)
+        constexpr uint8 VisitResolved = 2;
+
+        /**
+         * @brief 배열에서 값 하나를 찾아 맨 끝 항목과 교체 후 제거 (선행 조건 연결 수는 적으므로 선형 탐색)
+         */
+        void EraseSwap(std::vector<uint32>& records, uint32 record)
+        {
+            auto it = std::find(records.begin(), records.end(), record);
+            if (it != records.end())
+            {
+                *it = records.back();
+                records.pop_back();
+            }
+        }
+    } // namespace
+
+    TickManager::TickManager(TransformHierarchy* transformHierarchy, JobSystem* jobSystem)
+        : m_transformHierarchy(transformHierarchy), m_jobSystem(jobSystem)
+    {
+    }
+
+    TickManager::~TickManager() = default;
+
+    //////////////////////////////////////////////////////////////
+    // 등록
+    //////////////////////////////////////////////////////////////
+
+    void TickManager::Register(TickState& state, IUpdatable* object)
+    {
+        // Update 를 재정의하지 않은 객체는 레코드를 만들지 않음 (선행 조건으로 연결될 때만 생성)
+        if (!state.Function)
+            return;
+
+        const uint32 index       = AcquireRecord(state, object);
+        m_records[index].Elapsed = 0.0f;
+        Refresh(index);
+    }
+
+    void TickManager::Unregister(TickState& state)
+    {
+        const uint32 index = state.RecordIndex;
+        if (index == TickState::InvalidIndex)
+            return;
+
+        TickRecord& record = m_records[index];
+        if (record.SlotIndex != TickState::InvalidIndex)
+        {
+            Remove(index);
+        }
+
+        // 선행 조건 연결 해제 (반환된 레코드를 가리키지 않도록 양쪽 모두에서 제거)
+        if (!record.Prerequisites.empty() || !record.Dependents.empty())
+        {
+            for (uint32 prerequisite : record.Prerequisites)
+            {
+                EraseSwap(m_records[prerequisite].Dependents, index);
+            }
+            for (uint32 dependent : record.Dependents)
+            {
+                EraseSwap(m_records[dependent].Prerequisites, index);
+                Refresh(dependent); // 남은 선행 조건이 없으면 원래 그룹의 첫 단계로 이동
+            }
+            record.Prerequisites.clear();
+            record.Dependents.clear();
+            m_isOrderDirty = true;
+        }
+        RemoveLinked(index);
+
+        // 레코드 반환 (연결 배열의 용량은 재사용)
+        record.State      = nullptr;
+        record.Object     = nullptr;
+        state.RecordIndex = TickState::InvalidIndex;
+        m_freeRecords.push_back(index);
+    }
+
+    void TickManager::Refresh(TickState& state)
+    {
+        // 레코드가 없으면 Tick 하지 않고 선행 조건 연결도 없는 객체
+        if (state.RecordIndex != TickState::InvalidIndex)
+        {
+            Refresh(state.RecordIndex);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 선행 조건
+    //////////////////////////////////////////////////////////////
+
+    void TickManager::AddPrerequisite(TickState& state, TickState& prerequisite)
+    {
+        if (&state == &prerequisite)
+            return;
+
+        // 레코드가 없는 쪽은 Tick 하지 않는 객체이므로 Update 대상 없이 레코드 생성
+        const uint32 index             = AcquireRecord(state, nullptr);
+        const uint32 prerequisiteIndex = AcquireRecord(prerequisite, nullptr);
+
+        TickRecord& record = m_records[index];
+        if (std::find(record.Prerequisites.begin(), record.Prerequisites.end(), prerequisiteIndex) != record.Prerequisites.end())
+            return;
+
+        record.Prerequisites.push_back(prerequisiteIndex);
+        m_records[prerequisiteIndex].Dependents.push_back(index);
+        Refresh(index);
+    }
+
+    void TickManager::RemovePrerequisite(TickState& state, TickState& prerequisite)
+    {
+        const uint32 index             = state.RecordIndex;
+        const uint32 prerequisiteIndex = prerequisite.RecordIndex;
+        if (index == TickState::InvalidIndex || prerequisiteIndex == TickState::InvalidIndex)
+            return;
+
+        EraseSwap(m_records[index].Prerequisites, prerequisiteIndex);
+        EraseSwap(m_records[prerequisiteIndex].Dependents, index);
+        Refresh(index);
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Tick
+    //////////////////////////////////////////////////////////////
+
+    void TickManager::Tick(float deltaTime)
+    {
+        if (m_isOrderDirty)
+        {
+            RebuildOrder();
+        }
+
+        m_isTicking = true;
+
+        // 그룹 순서대로, 그룹 안에서는 선행 조건 깊이 순서대로 실행 (앞 단계가 모두 끝나야 다음 단계 시작)
+        for (std::vector<Stage>& stages : m_stages)
+        {
+            for (Stage& stage : stages)
+            {
+                TickStage(stage, deltaTime);
+            }
+        }
+
+        m_isTicking = false;
+
+        // Tick 도중의 변경 반영 (반영 중 다시 쌓이지 않도록 목록을 꺼내서 처리)
+        if (!m_queuedRecords.empty())
+        {
+            std::vector<uint32> queuedRecords;
+            queuedRecords.swap(m_queuedRecords);
+            for (uint32 index : queuedRecords)
+            {
+                TickRecord& record = m_records[index];
+                record.IsQueued    = false;
+                if (record.State)
+                {
+                    Refresh(index);
+                }
+            }
+        }
+    }
+
+    void TickManager::SetSyncFunction(TickSyncFunction function, void* context)
+    {
+        m_syncFunction = function;
+        m_syncContext  = context;
+    }
+
+    uint32 TickManager::GetBucketCount() const
+    {
+        uint32 count = 0;
+        for (const std::vector<Stage>& stages : m_stages)
+        {
+            for (const Stage& stage : stages)
+            {
+                count += static_cast<uint32>(stage.Buckets.size());
+            }
+        }
+        return count;
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Private
+    //////////////////////////////////////////////////////////////
+
+    uint32 TickManager::AcquireRecord(TickState& state, IUpdatable* object)
+    {
+        if (state.RecordIndex != TickState::InvalidIndex)
+            return state.RecordIndex;
+
+        uint32 index;
+        if (!m_freeRecords.empty())
+        {
+            index = m_freeRecords.back();
+            m_freeRecords.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32>(m_records.size());
+            m_records.emplace_back();
+        }
+
+        TickRecord& record    = m_records[index];
+        record.State          = &state;
+        record.Object         = object;
+        record.Elapsed        = 0.0f;
+        record.EffectiveGroup = state.Group;
+        record.Depth          = 0;
+        record.SlotIndex      = TickState::InvalidIndex;
+        record.LinkedIndex    = TickState::InvalidIndex;
+        record.IsQueued       = false;
+        record.VisitState     = VisitNone;
+        state.RecordIndex     = index;
+        return index;
+    }
+
+    void TickManager::Refresh(uint32 index)
+    {
+        TickRecord& record = m_records[index];
+
+        // Tick 도중이면 목록을 바꾸지 않고 Tick 이후에 반영
+        if (m_isTicking)
+        {
+            if (!record.IsQueued)
+            {
+                record.IsQueued = true;
+                m_queuedRecords.push_back(index);
+            }
+            return;
+        }
+
+        // 선행 조건이 있으면 실행 순서를 다음 Tick 에서 다시 계산 (그 전까지는 이전 순서 유지)
+        if (!record.Prerequisites.empty())
+        {
+            if (record.LinkedIndex == TickState::InvalidIndex)
+            {
+                record.LinkedIndex = static_cast<uint32>(m_linkedRecords.size());
+                m_linkedRecords.push_back(index);
+            }
+            m_isOrderDirty = true;
+        }
+        else
+        {
+            RemoveLinked(index);
+            record.EffectiveGroup = record.State->Group;
+            record.Depth          = 0;
+        }
+
+        if (!record.Dependents.empty())
+        {
+            m_isOrderDirty = true; // 그룹이 바뀌었으면 이 객체 뒤에 실행할 객체의 순서도 바뀜
+        }
+
+        UpdatePlacement(index);
+    }
+
+    void TickManager::TickStage(Stage& stage, float deltaTime)
+    {
+        // 1. 병렬 목록: 버킷마다 ParallelFor (작업 시스템이 없으면 메인 스레드에서 그대로 실행)
+        //    병렬 구간의 트랜스폼 변경 알림은 계층 구조의 공유 카운터를 건드리지 않도록 모아 두었다가 끝난 뒤 한 번에 반영
+        bool hasParallelTicks   = false;
+        bool isDeferringChanges = false;
+        for (Bucket& bucket : stage.Buckets)
+        {
+            const uint32 count = static_cast<uint32>(bucket.Parallel.Objects.size());
+            if (count == 0)
+                continue;
+
+            hasParallelTicks = true;
+            if (!m_jobSystem)
+            {
+                bucket.Function(bucket.Parallel.Objects.data(), count, deltaTime);
+                continue;
+            }
+
+            if (m_transformHierarchy && !isDeferringChanges)
+            {
+                m_transformHierarchy->BeginDeferredChanges();
+                isDeferringChanges = true;
+            }
+
+            const uint32       grainSize = std::max(MinParallelGrainSize, count / (m_jobSystem->GetThreadCount() * 8));
+            IUpdatable* const* objects   = bucket.Parallel.Objects.data();
+            TickBatchFunction  function  = bucket.Function;
+            m_jobSystem->ParallelFor(count, grainSize, [objects, function, deltaTime](uint32 begin, uint32 end) { function(objects + begin, end - begin, deltaTime); });
+        }
+
+        if (isDeferringChanges)
+        {
+            m_transformHierarchy->EndDeferredChanges();
+        }
+
+        // 작업 시스템이 없어 메인 스레드에서 실행했어도 같은 지점에서 동기화 (실행 환경과 무관하게 결과가 같도록)
+        if (hasParallelTicks && m_syncFunction)
+        {
+            m_syncFunction(m_syncContext);
+        }
+
+        // 2. 메인 스레드 목록
+        for (Bucket& bucket : stage.Buckets)
+        {
+            if (!bucket.MainThread.Objects.empty())
+            {
+                bucket.Function(bucket.MainThread.Objects.data(), static_cast<uint32>(bucket.MainThread.Objects.size()), deltaTime);
+            }
+        }
+
+        // 3. 간격 목록: 경과 시간이 간격을 넘은 객체만 누적 시간으로 Update
+        for (Bucket& bucket : stage.Buckets)
+        {
+            for (uint32 index : bucket.IntervalRecords)
+            {
+                TickRecord& record = m_records[index];
+                record.Elapsed += deltaTime;
+                if (record.Elapsed >= record.State->Interval)
+                {
+                    // Update 에서 다른 객체를 등록하면 레코드 테이블이 재할당될 수 있으므로 호출 전에 값을 꺼내 둠
+                    IUpdatable* object  = record.Object;
+                    const float elapsed = record.Elapsed;
+                    record.Elapsed      = 0.0f;
+                    bucket.Function(&object, 1, elapsed);
+                }
+            }
+        }
+    }
+
+    void TickManager::RebuildOrder()
+    {
+        for (uint32 index : m_linkedRecords)
+        {
+            m_records[index].VisitState = VisitNone;
+        }
+        for (uint32 index : m_linkedRecords)
+        {
+            ResolveOrder(index);
+        }
+        for (uint32 index : m_linkedRecords)
+        {
+            UpdatePlacement(index);
+        }
+
+        m_isOrderDirty = false;
+    }
+
+    void TickManager::ResolveOrder(uint32 root)
+    {
+        if (m_records[root].VisitState != VisitNone)
+            return; // 이미 계산함
+
+        // 선행 조건 사슬이 길어도 호출 스택이 넘치지 않도록 명시적 스택으로 깊이 우선 탐색
+        m_records[root].VisitState = VisitActive;
+        m_resolveStack.clear();
+        m_resolveStack.push_back(ResolveFrame{ root, 0 });
+
+        while (!m_resolveStack.empty())
+        {
+            ResolveFrame& frame  = m_resolveStack.back();
+            TickRecord&   record = m_records[frame.Record];
+
+            // 1. 아직 계산하지 않은 선행 조건이 있으면 그것부터 계산 (선행 조건이 없는 레코드는 Group / 0 으로 이미 정해져 있음)
+            uint32 next = TickState::InvalidIndex;
+            while (frame.NextPrerequisite < record.Prerequisites.size())
+            {
+                const uint32      prerequisiteIndex = record.Prerequisites[frame.NextPrerequisite++];
+                const TickRecord& prerequisite      = m_records[prerequisiteIndex];
+                if (prerequisite.LinkedIndex != TickState::InvalidIndex && prerequisite.VisitState == VisitNone)
+                {
+                    next = prerequisiteIndex;
+                    break;
+                }
+            }
+            if (next != TickState::InvalidIndex)
+            {
+                m_records[next].VisitState = VisitActive;
+                m_resolveStack.push_back(ResolveFrame{ next, 0 }); // frame 은 더 이상 사용하지 않음 (재할당으로 무효화될 수 있음)
+                continue;
+            }
+
+            // 2. 선행 조건이 모두 계산되었으면 그룹 / 깊이 결정
+            ETickGroup group = record.State->Group;
+            uint32     depth = 0;
+            for (uint32 prerequisiteIndex : record.Prerequisites)
+            {
+                // 계산 중인 선행 조건은 순환을 이루는 간선이므로 무시 (이전 값을 쓰면 다시 계산할 때마다 깊이가 늘어남)
+                const TickRecord& prerequisite = m_records[prerequisiteIndex];
+                if (prerequisite.VisitState == VisitActive)
+                    continue;
+
+                // 선행 조건이 더 늦은 그룹이면 그 그룹으로 미루고, 같은 그룹이면 선행 조건의 다음 단계에서 실행
+                if (prerequisite.EffectiveGroup > group)
+                {
+                    group = prerequisite.EffectiveGroup;
+                    depth = prerequisite.Depth + 1;
+                }
+                else if (prerequisite.EffectiveGroup == group)
+                {
+                    depth = std::max(depth, prerequisite.Depth + 1);
+                }
+            }
+
+            record.EffectiveGroup = group;
+            record.Depth          = depth;
+            record.VisitState     = VisitResolved;
+            m_resolveStack.pop_back();
+        }
+    }
+
+    void TickManager::UpdatePlacement(uint32 index)
+    {
+        TickRecord&      record     = m_records[index];
+        const TickState& state      = *record.State;
+        const bool       shouldTick = state.IsEnabled && state.Function && record.Object;
+        const bool       isInterval = state.Interval > 0.0f;
+        const bool       isParallel = state.IsParallel && !isInterval;
+
+        // 단계 / 목록이 바뀌었으면 제거 후 다시 추가
+        if (record.SlotIndex != TickState::InvalidIndex)
+        {
+            const bool isMoved = record.PlacedGroup != record.EffectiveGroup || record.PlacedDepth != record.Depth ||
+                                 record.IsInterval != isInterval || record.IsInParallelList != isParallel;
+            if (!shouldTick || isMoved)
+            {
+                Remove(index);
+            }
+        }
+
+        if (shouldTick && record.SlotIndex == TickState::InvalidIndex)
+        {
+            Insert(index);
+        }
+    }
+
+    void TickManager::RemoveLinked(uint32 index)
+    {
+        TickRecord&  record = m_records[index];
+        const uint32 linked = record.LinkedIndex;
+        if (linked == TickState::InvalidIndex)
+            return;
+
+        const uint32 last = static_cast<uint32>(m_linkedRecords.size()) - 1;
+        if (linked != last)
+        {
+            m_linkedRecords[linked]                        = m_linkedRecords[last];
+            m_records[m_linkedRecords[linked]].LinkedIndex = linked;
+        }
+        m_linkedRecords.pop_back();
+        record.LinkedIndex = TickState::InvalidIndex;
+    }
+
+    void TickManager::Insert(uint32 index)
+    {
+        TickRecord&      record = m_records[index];
+        const TickState& state  = *record.State;
+
+        std::vector<Stage>& stages = m_stages[static_cast<size_t>(record.EffectiveGroup)];
+        if (stages.size() <= record.Depth)
+        {
+            stages.resize(record.Depth + 1);
+        }
+
+        Stage& stage = stages[record.Depth];
+
+        record.PlacedGroup      = record.EffectiveGroup;
+        record.PlacedDepth      = record.Depth;
+        record.BucketIndex      = FindOrAddBucket(stage, state.Function);
+        record.IsInterval       = state.Interval > 0.0f;
+        record.IsInParallelList = state.IsParallel && !record.IsInterval;
+
+        Bucket& bucket = stage.Buckets[record.BucketIndex];
+        if (record.IsInterval)
+        {
+            record.SlotIndex = static_cast<uint32>(bucket.IntervalRecords.size());
+            bucket.IntervalRecords.push_back(index);
+        }
+        else
+        {
+            TickList& list   = record.IsInParallelList ? bucket.Parallel : bucket.MainThread;
+            record.SlotIndex = static_cast<uint32>(list.Objects.size());
+            list.Objects.push_back(record.Object);
+            list.Records.push_back(index);
+        }
+
+        m_tickingCount++;
+    }
+
+    void TickManager::Remove(uint32 index)
+    {
+        TickRecord&  record = m_records[index];
+        Bucket&      bucket = m_stages[static_cast<size_t>(record.PlacedGroup)][record.PlacedDepth].Buckets[record.BucketIndex];
+        const uint32 slot   = record.SlotIndex;
+
+        if (record.IsInterval)
+        {
+            const uint32 last = static_cast<uint32>(bucket.IntervalRecords.size()) - 1;
+            if (slot != last)
+            {
+                bucket.IntervalRecords[slot]                      = bucket.IntervalRecords[last];
+                m_records[bucket.IntervalRecords[slot]].SlotIndex = slot;
+            }
+            bucket.IntervalRecords.pop_back();
+        }
+        else
+        {
+            TickList&    list = record.IsInParallelList ? bucket.Parallel : bucket.MainThread;
+            const uint32 last = static_cast<uint32>(list.Objects.size()) - 1;
+            if (slot != last)
+            {
+                list.Objects[slot]                      = list.Objects[last];
+                list.Records[slot]                      = list.Records[last];
+                m_records[list.Records[slot]].SlotIndex = slot;
+            }
+            list.Objects.pop_back();
+            list.Records.pop_back();
+        }
+
+        record.SlotIndex = TickState::InvalidIndex;
+        m_tickingCount--;
+    }
+
+    uint32 TickManager::FindOrAddBucket(Stage& stage, TickBatchFunction function)
+    {
+        auto [it, isInserted] = stage.BucketIndices.try_emplace(function, static_cast<uint32>(stage.Buckets.size()));
+        if (isInserted)
+        {
+            stage.Buckets.push_back(Bucket{ function, {}, {}, {} });
+        }
+        return it->second;
+    }
+} // namespace TDME
\ No newline at end of file
@@ -0,0 +1,463 @@
+#include "pch.h"
+#include "Engine/World/TransformHierarchy.h"
+
+#include <Core/Math/Transform.h>
+
+#include "Engine/Object/Component/GSceneComponent.h"
+
+#include <algorithm>
+
+namespace TDME
+{
+    TransformHierarchy::TransformHierarchy() = default;
+
+    TransformHierarchy::~TransformHierarchy()
+    {
+        // 남아 있는 컴포넌트는 지연 계산 경로로 되돌림
+        for (uint32 i = 0; i < static_cast<uint32>(m_components.size()); i++)
+        {
+            if (m_components[i])
+            {
+                ReleaseNode(i);
+            }
+        }
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 노드 관리
+    //////////////////////////////////////////////////////////////
+
+    void TransformHierarchy::Register(GSceneComponent* component)
+    {
+        if (!component || component->m_hierarchy)
+            return;
+
+        component->m_hierarchy      = this;
+        component->m_hierarchyIndex = static_cast<uint32>(m_components.size());
+
+        m_components.push_back(component);
+        m_parentIndices.push_back(InvalidIndex);
+        m_worldMatrices.push_back(Matrix3x4::Identity()); // Dirty 이므로 다음 읽기 / Update 에서 계산 (등록마다 순서를 재구성하지 않도록 여기서 읽지 않음)
+        m_worldVersions.push_back(component->m_worldVersion); // 버전이 되돌아가지 않도록 이어서 사용
+        m_parentVersions.push_back(0);
+        m_verifiedEpochs.push_back(0);
+        m_dirtyFlags.push_back(1);
+        m_externalFlags.push_back(0);
+        m_hasPendingChanges = true;
+
+        if (m_isStructureDirty)
+            return; // 어차피 재구성됨
+
+        // 1. 먼저 등록된 자식이 있으면 자식이 앞에 있으므로 재구성 (보통은 부모부터 등록되므로 드묾)
+        for (GSceneComponent* child = component->m_firstChild; child; child = child->m_nextSibling)
+        {
+            if (child->m_hierarchy == this)
+            {
+                MarkStructureDirty();
+                return;
+            }
+        }
+
+        // 2. Bake 대상이면 정적 영역에 넣어야 하므로 재구성
+        if (ShouldBake(component))
+        {
+            MarkStructureDirty();
+            return;
+        }
+
+        // 3. 새 루트 / 이미 등록된 부모 아래의 노드: 끝에 추가한 것만으로 순서가 유지되므로 부모 인덱스만 연결
+        RelinkSubtree(component->m_hierarchyIndex);
+    }
+
+    void TransformHierarchy::Reserve(uint32 count)
+    {
+        // 작은 묶음으로 여러 번 호출해도 재할당이 누적되지 않도록 최소 두 배로 늘림
+        const size_t required = m_components.size() + count;
+        if (required <= m_components.capacity())
+            return;
+
+        const size_t capacity = std::max(required, m_components.capacity() * 2);
+        m_components.reserve(capacity);
+        m_parentIndices.reserve(capacity);
+        m_worldMatrices.reserve(capacity);
+        m_worldVersions.reserve(capacity);
+        m_parentVersions.reserve(capacity);
+        m_verifiedEpochs.reserve(capacity);
+        m_dirtyFlags.reserve(capacity);
+        m_externalFlags.reserve(capacity);
+    }
+
+    void TransformHierarchy::Unregister(GSceneComponent* component)
+    {
+        if (!component || component->m_hierarchy != this)
+            return;
+
+        const uint32 index = component->m_hierarchyIndex;
+        ReleaseNode(index);
+        m_components[index] = nullptr;
+        m_emptySlotCount++;
+        m_hasPendingChanges = true;
+
+        // 정적 영역에는 빈 슬롯을 남기지 않음 (렌더러가 그대로 읽음). 빈 슬롯이 많아지면 압축
+        if (m_isStructureDirty || index < m_staticCount || m_emptySlotCount * 4 > m_components.size())
+        {
+            MarkStructureDirty();
+            return;
+        }
+
+        // 아직 연결된 자식은 부모가 미등록 상태가 되었으므로 외부 부모로 전환 (빈 슬롯을 가리키지 않도록)
+        for (GSceneComponent* child = component->m_firstChild; child; child = child->m_nextSibling)
+        {
+            if (child->m_hierarchy == this)
+            {
+                RelinkSubtree(child->m_hierarchyIndex);
+            }
+        }
+    }
+
+    void TransformHierarchy::NotifyParentChanged(GSceneComponent* component)
+    {
+        if (!component || component->m_hierarchy != this || m_isStructureDirty)
+            return;
+
+        const uint32           index  = component->m_hierarchyIndex;
+        const GSceneComponent* parent = component->m_parent;
+
+        // 1. 부모가 뒤에 있으면 부모가 먼저 계산되지 않으므로 재구성
+        if (parent && parent->m_hierarchy == this && parent->m_hierarchyIndex > index)
+        {
+            MarkStructureDirty();
+            return;
+        }
+
+        // 2. Bake 여부가 바뀌면 정적 영역이 바뀌므로 재구성 (자손의 Bake 여부는 이 노드를 따름)
+        if ((index < m_staticCount) != ShouldBake(component))
+        {
+            MarkStructureDirty();
+            return;
+        }
+
+        // 3. 순서가 유지되므로 제자리에서 부모 인덱스만 갱신 (ResolveNode 가 새 부모 체인을 다시 확인하도록 시점 증가)
+        RelinkSubtree(index);
+        m_hasPendingChanges = true;
+        m_changeEpoch++;
+    }
+
+    void TransformHierarchy::NotifyMobilityChanged(GSceneComponent* component)
+    {
+        if (!component || component->m_hierarchy != this || m_isStructureDirty)
+            return;
+
+        if ((component->m_hierarchyIndex < m_staticCount) != ShouldBake(component))
+        {
+            MarkStructureDirty();
+        }
+    }
+
+    void TransformHierarchy::EndDeferredChanges()
+    {
+        m_isDeferringChanges = false;
+
+        // 어떤 노드가 바뀌었는지 따로 모으지 않았으므로 변경이 있었던 것으로 간주 (다음 읽기 / Update 에서 플래그로 걸러짐)
+        m_hasPendingChanges = true;
+        m_changeEpoch++;
+        GSceneComponent::s_changeEpoch++; // 등록되지 않은 자식 컴포넌트의 캐시도 재확인하도록
+
+        // Bake 된 노드가 움직였으면 정적 영역 재 Bake (정적 영역의 플래그만 확인)
+        for (uint32 i = 0; i < m_staticCount && !m_isStaticDirty; i++)
+        {
+            m_isStaticDirty = m_dirtyFlags[i] != 0;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////
+    // 갱신
+    //////////////////////////////////////////////////////////////
+
+    void TransformHierarchy::Update()
+    {
+        if (m_isStructureDirty)
+        {
+            RebuildOrder();
+        }
+
+        // 1. 정적 영역은 Bake 된 노드가 바뀌었을 때만 순회
+        if (m_isStaticDirty)
+        {
+            bool isStaticChanged = false;
+            for (uint32 i = 0; i < m_staticCount; i++)
+            {
+                isStaticChanged |= UpdateNode(i);
+            }
+
+            if (isStaticChanged)
+            {
+                m_staticVersion++;
+            }
+            m_isStaticDirty = false;
+        }
+
+        // 2. 부모가 항상 먼저 처리되므로 정적 영역 이후를 앞에서부터 한 번 순회하면 모든 노드가 최신 상태가 됨
+        const uint32 count = static_cast<uint32>(m_components.size());
+        for (uint32 i = m_staticCount; i < count; i++)
+        {
+            if (m_components[i])
+            {
+                UpdateNode(i);
+            }
+        }
+
+        m_hasPendingChanges = false;
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Getter
+    //////////////////////////////////////////////////////////////
+
+    const Matrix3x4& TransformHierarchy::GetWorldMatrix(const GSceneComponent* component)
+    {
+        if (m_isStructureDirty)
+        {
+            RebuildOrder();
+        }
+
+        const uint32 index = component->m_hierarchyIndex;
+        if (index < m_staticCount && !m_isStaticDirty)
+        {
+            return m_worldMatrices[index]; // Bake 된 값
+        }
+
+        if (m_hasPendingChanges || m_externalFlags[index])
+        {
+            ResolveNode(index);
+        }
+        return m_worldMatrices[index];
+    }
+
+    uint32 TransformHierarchy::GetWorldVersion(const GSceneComponent* component)
+    {
+        (void)GetWorldMatrix(component);
+        return m_worldVersions[component->m_hierarchyIndex];
+    }
+
+    bool TransformHierarchy::IsBaked(const GSceneComponent* component)
+    {
+        if (m_isStructureDirty)
+        {
+            RebuildOrder();
+        }
+        return component->m_hierarchyIndex < m_staticCount;
+    }
+
+    //////////////////////////////////////////////////////////////
+    // Private
+    //////////////////////////////////////////////////////////////
+
+    void TransformHierarchy::RebuildOrder()
+    {
+        m_orderedComponents.clear();
+        m_dynamicComponents.clear();
+        m_dynamicComponents.reserve(m_components.size());
+
+        // 1. 루트(부모가 없거나 다른 계층 구조에 속한 노드)부터 깊이 우선 순회 (전위 순회 = 부모가 항상 먼저)
+        //    자신과 모든 조상이 Static 인 노드는 정적 영역으로 분리. 정적 노드의 부모도 정적이므로 두 영역 모두 부모가 먼저 옴
+        for (GSceneComponent* root : m_components)
+        {
+            if (!root || (root->m_parent && root->m_parent->m_hierarchy == this))
+                continue;
+
+            m_orderStack.emplace_back(root, root->m_parent == nullptr); // (노드, 부모가 Bake 대상인지). 다른 계층 구조의 부모는 움직일 수 있으므로 Bake 불가
+            while (!m_orderStack.empty())
+            {
+                const auto [node, isParentBaked] = m_orderStack.back();
+                m_orderStack.pop_back();
+
+                const bool isBaked = isParentBaked && node->m_mobility == EComponentMobility::Static;
+                (isBaked ? m_orderedComponents : m_dynamicComponents).push_back(node);
+
+                // 역순으로 넣어 자식 순서를 유지
+                GSceneComponent* const first = node->m_firstChild;
+                for (GSceneComponent* child = first ? first->m_prevSibling : nullptr; child; child = (child == first) ? nullptr : child->m_prevSibling)
+                {
+                    if (child->m_hierarchy == this)
+                    {
+                        m_orderStack.emplace_back(child, isBaked);
+                    }
+                }
+            }
+        }
+
+        const uint32 staticCount           = static_cast<uint32>(m_orderedComponents.size());
+        const bool   isStaticLayoutChanged = staticCount != m_staticCount ||
+                                           !std::equal(m_orderedComponents.begin(), m_orderedComponents.end(), m_components.begin());
+
+        m_staticCount = staticCount;
+        m_orderedComponents.insert(m_orderedComponents.end(), m_dynamicComponents.begin(), m_dynamicComponents.end());
+
+        // 2. 새 순서로 배열 재구성 (World Matrix / 버전 / 로컬 변경 여부 유지, 임시 배열에 채운 뒤 교환)
+        //    부모가 바뀐 노드는 부착/분리 시 로컬 버전이 올라가므로 전부 재계산할 필요 없음
+        const size_t count = m_orderedComponents.size();
+        m_scratchWorldMatrices.resize(count);
+        m_scratchWorldVersions.resize(count);
+        m_scratchParentVersions.resize(count);
+        m_scratchDirtyFlags.resize(count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint32 oldIndex      = m_orderedComponents[i]->m_hierarchyIndex;
+            m_scratchWorldMatrices[i]  = m_worldMatrices[oldIndex];
+            m_scratchWorldVersions[i]  = m_worldVersions[oldIndex];
+            m_scratchParentVersions[i] = m_parentVersions[oldIndex];
+            m_scratchDirtyFlags[i]     = m_dirtyFlags[oldIndex];
+        }
+
+        m_parentIndices.assign(count, InvalidIndex);
+        m_externalFlags.assign(count, 0);
+        m_verifiedEpochs.assign(count, 0);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            GSceneComponent* component  = m_orderedComponents[i];
+            component->m_hierarchyIndex = static_cast<uint32>(i);
+
+            if (component->m_parent && component->m_parent->m_hierarchy == this)
+            {
+                const uint32 parent = component->m_parent->m_hierarchyIndex; // 부모는 앞에서 이미 재배치됨
+                m_parentIndices[i]  = static_cast<int32>(parent);
+                m_externalFlags[i]  = m_externalFlags[parent];
+            }
+            else if (component->m_parent)
+            {
+                m_externalFlags[i] = 1;
+            }
+        }
+
+        m_components.swap(m_orderedComponents);
+        m_worldMatrices.swap(m_scratchWorldMatrices);
+        m_worldVersions.swap(m_scratchWorldVersions);
+        m_parentVersions.swap(m_scratchParentVersions);
+        m_dirtyFlags.swap(m_scratchDirtyFlags);
+        m_emptySlotCount   = 0;
+        m_isStructureDirty = false;
+        m_changeEpoch++;
+
+        // 새로 정적 영역에 들어온 노드는 아직 Bake 되지 않았을 수 있으므로 다음 Update 에서 정적 영역을 한 번 순회
+        if (isStaticLayoutChanged)
+        {
+            m_isStaticDirty = m_staticCount > 0;
+            m_staticVersion++;
+        }
+    }
+
+    bool TransformHierarchy::ShouldBake(const GSceneComponent* component) const
+    {
+        if (component->m_mobility != EComponentMobility::Static)
+            return false;
+
+        const GSceneComponent* parent = component->m_parent;
+        return !parent || (parent->m_hierarchy == this && parent->m_hierarchyIndex < m_staticCount);
+    }
+
+    void TransformHierarchy::RelinkSubtree(uint32 index)
+    {
+        GSceneComponent*       component = m_components[index];
+        const GSceneComponent* parent    = component->m_parent;
+
+        uint8 isExternal;
+        if (parent && parent->m_hierarchy == this)
+        {
+            m_parentIndices[index] = static_cast<int32>(parent->m_hierarchyIndex);
+            isExternal             = m_externalFlags[parent->m_hierarchyIndex];
+        }
+        else
+        {
+            m_parentIndices[index] = InvalidIndex;
+            isExternal             = parent ? 1 : 0;
+        }
+
+        // 이 계층 구조 안의 자손은 항상 이 노드와 같은 값을 가지므로 바뀌었을 때만 전파
+        if (m_externalFlags[index] == isExternal)
+            return;
+
+        m_relinkStack.push_back(component);
+        while (!m_relinkStack.empty())
+        {
+            GSceneComponent* node = m_relinkStack.back();
+            m_relinkStack.pop_back();
+
+            m_externalFlags[node->m_hierarchyIndex] = isExternal;
+            for (GSceneComponent* child = node->m_firstChild; child; child = child->m_nextSibling)
+            {
+                if (child->m_hierarchy == this)
+                {
+                    m_relinkStack.push_back(child);
+                }
+            }
+        }
+    }
+
+    bool TransformHierarchy::UpdateNode(uint32 index)
+    {
+        const GSceneComponent* component = m_components[index];
+        const int32            parent    = m_parentIndices[index];
+
+        const Matrix3x4* parentWorld   = nullptr;
+        uint32           parentVersion = 0;
+        if (parent != InvalidIndex)
+        {
+            parentWorld   = &m_worldMatrices[parent];
+            parentVersion = m_worldVersions[parent];
+        }
+        else if (component->m_parent)
+        {
+            // 다른 계층 구조(또는 미등록)의 부모: 부모 쪽에서 최신 상태로 만든 뒤 버전 비교
+            parentWorld   = &component->m_parent->GetWorldMatrix3x4();
+            parentVersion = component->m_parent->PeekWorldVersion();
+        }
+
+        if (!m_dirtyFlags[index] && m_parentVersions[index] == parentVersion)
+            return false;
+
+        const Matrix3x4 localMatrix = component->m_transform.ToMatrix3x4();
+
+        // Local Matrix x Parent World Matrix
+        m_worldMatrices[index]  = parentWorld ? localMatrix * *parentWorld : localMatrix;
+        m_parentVersions[index] = parentVersion;
+        m_dirtyFlags[index]     = 0;
+        m_worldVersions[index]++;
+        return true;
+    }
+
+    void TransformHierarchy::ResolveNode(uint32 index)
+    {
+        // 1. 이번 변경 이후 이미 확인한 조상을 만날 때까지 부모 체인을 수집
+        //    (다른 계층 구조의 부모 아래에 있는 노드는 변경 알림을 받을 수 없으므로 항상 루트까지, Bake 된 조상에서는 항상 멈춤)
+        //    UpdateNode 가 다른 계층 구조를 거쳐 다시 호출될 수 있으므로 스택은 base 위쪽만 사용
+        const size_t base    = m_resolveStack.size();
+        int32        current = static_cast<int32>(index);
+        const int32  bakedEnd = m_isStaticDirty ? 0 : static_cast<int32>(m_staticCount);
+        while (current >= bakedEnd && (m_externalFlags[current] || m_verifiedEpochs[current] != m_changeEpoch))
+        {
+            m_resolveStack.push_back(static_cast<uint32>(current));
+            current = m_parentIndices[current];
+        }
+
+        // 2. 위에서부터 오래된 노드만 재계산
+        for (size_t i = m_resolveStack.size(); i > base; i--)
+        {
+            const uint32 node = m_resolveStack[i - 1];
+            UpdateNode(node);
+            m_verifiedEpochs[node] = m_changeEpoch;
+        }
+        m_resolveStack.resize(base);
+    }
+
+    void TransformHierarchy::ReleaseNode(uint32 index)
+    {
+        GSceneComponent* component = m_components[index];
+
+        component->m_hierarchy    = nullptr;
+        component->m_worldVersion = m_worldVersions[index];
+        component->SetTransformDirty(); // 지연 계산 경로의 캐시는 오래되었으므로 다음 읽기에서 재계산
+    }
+} // namespace TDME
\ No newline at end of file
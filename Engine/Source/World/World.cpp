@@ -4,8 +4,9 @@
 namespace TDME
 {
     World::World()
-        : m_persistentLevel(std::make_unique<Level>())
+        : m_handleTable(), m_jobSystem(), m_persistentLevel(std::make_unique<Level>(&m_handleTable, &m_jobSystem))
     {
+        ClassInfo::BuildRegistry(); // 병렬 Tick / 작업에서 IsA / Cast 가 처음 호출되기 전에 클래스 번호를 계산해 둠
     }
 
     World::~World() = default;
@@ -31,9 +31,9 @@ VS_OUTPUT VS_MAIN(VS_INPUT input)
 {
 	VS_OUTPUT output;
 
-	float4 worldPos = mul(float4(input.Position, 1.0f), World);	// Row-Vector 이므로 (Vector * Matrix)
-	float4 viewPos  = mul(worldPos, View);
-	output.Position = mul(viewPos, Projection);
+	float3 worldPos = mul(World, float4(input.Position, 1.0f));	// 3x4 는 전치된 아핀 행렬이므로 (Matrix * Vector)
+	float3 viewPos  = mul(View, float4(worldPos, 1.0f));
+	output.Position = mul(float4(viewPos, 1.0f), Projection);	// Row-Vector 이므로 (Vector * Matrix)
 
 	output.TexCoord = input.TexCoord;
 
@@ -1,6 +1,6 @@
 cbuffer Transform : register(b0)	// Constant Buffer (b = buffer)
 {
-    row_major matrix World; 	// 추후 조명 계산에서 World 좌표가 필요하므로 분리 전달
-    row_major matrix View;
-    row_major matrix Projection;
+    row_major float3x4 World; 	// 추후 조명 계산에서 World 좌표가 필요하므로 분리 전달 (아핀 행렬이므로 3x4, TMatrix3x4 와 같은 배치)
+    row_major float3x4 View;	// 아핀 행렬이므로 3x4
+    row_major matrix   Projection;
 };
\ No newline at end of file
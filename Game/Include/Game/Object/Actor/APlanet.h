@@ -13,6 +13,8 @@ namespace TDME
 
     class APlanet : public AActor, public IRenderable
     {
+        TDME_OBJECT_CLASS(APlanet, AActor)
+
     public:
         APlanet();
         ~APlanet() override = default;
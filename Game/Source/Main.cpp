@@ -7,6 +7,7 @@
 #include <Engine/RHI/Pipeline/IPipelineState.h>
 #include <Engine/RHI/Texture/ITexture.h>
 #include <Engine/Renderer/VertexTypes.h>
+#include <Engine/Renderer/Shape/ProceduralMesh.h>
 #include <Engine/Renderer/Shape/Shape3DRenderer.h>
 #include <Engine/World/World.h>
 #include <Engine/Object/Component/GCameraComponent.h>
@@ -178,71 +179,26 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
     constexpr TDME::uint32 SLICES        = 32;
     constexpr float        SPHERE_RADIUS = 50.0f;
 
-    // 1. 정점 생성 (단위 구, radius = 1)
-    std::vector<TDME::VertexPT> sphereVertices;
-    sphereVertices.reserve((STACKS + 1) * (SLICES + 1));
+    // 1. 단위 구 정점 / 인덱스 (컴파일 타임 생성, 런타임 삼각함수 계산 없음)
+    constexpr const auto&  sphereMesh = TDME::ProceduralMesh::UnitSphere<STACKS, SLICES>;
+    constexpr TDME::uint32 indexCount = sphereMesh.IndexCount;
 
-    for (TDME::uint32 i = 0; i <= STACKS; i++)
-    {
-        float phi    = TDME::Math::Pi * static_cast<float>(i) / static_cast<float>(STACKS);
-        float sinPhi = std::sin(phi);
-        float cosPhi = std::cos(phi);
-
-        for (TDME::uint32 j = 0; j <= SLICES; j++)
-        {
-            float theta    = TDME::Math::Pi2 * static_cast<float>(j) / static_cast<float>(SLICES);
-            float sinTheta = std::sin(theta);
-            float cosTheta = std::cos(theta);
-
-            TDME::Vector3 pos(sinPhi * cosTheta, cosPhi, sinPhi * sinTheta);
-            TDME::Vector2 uv(
-                static_cast<float>(j) / static_cast<float>(SLICES),
-                static_cast<float>(i) / static_cast<float>(STACKS));
-
-            sphereVertices.emplace_back(pos, uv);
-        }
-    }
-
-    // 2. 인덱스 생성
-    TDME::uint32              indexCount = STACKS * SLICES * 6;
-    std::vector<TDME::uint16> sphereIndices;
-    sphereIndices.reserve(indexCount);
-
-    for (TDME::uint32 i = 0; i < STACKS; i++)
-    {
-        for (TDME::uint32 j = 0; j < SLICES; j++)
-        {
-            TDME::uint16 topLeft     = static_cast<TDME::uint16>(i * (SLICES + 1) + j);
-            TDME::uint16 topRight    = static_cast<TDME::uint16>(i * (SLICES + 1) + j + 1);
-            TDME::uint16 bottomLeft  = static_cast<TDME::uint16>((i + 1) * (SLICES + 1) + j);
-            TDME::uint16 bottomRight = static_cast<TDME::uint16>((i + 1) * (SLICES + 1) + j + 1);
-
-            sphereIndices.push_back(topLeft);
-            sphereIndices.push_back(topRight);
-            sphereIndices.push_back(bottomLeft);
-
-            sphereIndices.push_back(topRight);
-            sphereIndices.push_back(bottomRight);
-            sphereIndices.push_back(bottomLeft);
-        }
-    }
-
-    // 3. GPU 버퍼 생성
+    // 2. GPU 버퍼 생성
     TDME::BufferDesc vbDesc;
     vbDesc.Type     = TDME::EBufferType::Vertex;
     vbDesc.Usage    = TDME::EBufferUsage::Default;
-    vbDesc.ByteSize = static_cast<TDME::uint32>(sphereVertices.size() * sizeof(TDME::VertexPT));
+    vbDesc.ByteSize = static_cast<TDME::uint32>(sizeof(sphereMesh.Vertices));
     vbDesc.Stride   = sizeof(TDME::VertexPT);
 
-    auto sphereVB = engine.Device->CreateBuffer(vbDesc, sphereVertices.data());
+    auto sphereVB = engine.Device->CreateBuffer(vbDesc, sphereMesh.Vertices.data());
 
     TDME::BufferDesc ibDesc;
     ibDesc.Type     = TDME::EBufferType::Index;
     ibDesc.Usage    = TDME::EBufferUsage::Default;
-    ibDesc.ByteSize = static_cast<TDME::uint32>(sphereIndices.size() * sizeof(TDME::uint16));
+    ibDesc.ByteSize = static_cast<TDME::uint32>(sizeof(sphereMesh.Indices));
     ibDesc.Stride   = sizeof(TDME::uint16);
 
-    auto sphereIB = engine.Device->CreateBuffer(ibDesc, sphereIndices.data());
+    auto sphereIB = engine.Device->CreateBuffer(ibDesc, sphereMesh.Indices.data());
 
     if (!sphereVB || !sphereIB)
     {
@@ -18,6 +18,8 @@ namespace TDME
 
         m_orbitOffset->AttachToComponent(m_orbit);
         m_body->AttachToComponent(m_orbitOffset); // Body를 OrbitPivot에 부착
+
+        SetTickInParallel(true); // Update 는 자신의 컴포넌트 로컬 회전만 변경
     }
 
     void APlanet::Update(float deltaTime)
@@ -57,6 +59,7 @@ namespace TDME
         if (parent)
         {
             m_orbit->AttachToComponent(parent->GetOrbitOffsetComponent()); // 공전 컴포넌트를 부모의 공전 Offset 컴포넌트에 부착
+            AddTickPrerequisite(parent);                                   // 부모 행성의 공전이 먼저 반영된 뒤 Update
         }
     }
 
@@ -21,16 +21,16 @@ namespace TDME
         BufferDesc cbDesc = {};
         cbDesc.Type       = EBufferType::Constant;
         cbDesc.Usage      = EBufferUsage::Dynamic;
-        cbDesc.ByteSize   = sizeof(TransformCB);
-        cbDesc.Stride     = sizeof(TransformCB);
+        cbDesc.ByteSize   = sizeof(TransformConstants);
+        cbDesc.Stride     = sizeof(TransformConstants);
 
         m_transformBuffer = m_device->CreateBuffer(cbDesc, nullptr);
 
         if (!m_transformBuffer)
             return false;
 
-        m_transformData.World      = Matrix::Identity();
-        m_transformData.View       = Matrix::Identity();
+        m_transformData.World      = Matrix3x4::Identity();
+        m_transformData.View       = Matrix3x4::Identity();
         m_transformData.Projection = Matrix::Identity();
 
         return true;
@@ -55,13 +55,13 @@ namespace TDME
 
     void DX11Renderer::SetWorldMatrix(const Matrix& matrix)
     {
-        m_transformData.World = matrix;
+        m_transformData.World = Matrix3x4::FromMatrix(matrix); // 아핀 행렬이므로 3x4 로 전달
         UpdateTransformCB();
     }
 
     void DX11Renderer::SetViewMatrix(const Matrix& matrix)
     {
-        m_transformData.View = matrix;
+        m_transformData.View = Matrix3x4::FromMatrix(matrix);
         UpdateTransformCB();
     }
 
@@ -90,7 +90,7 @@ namespace TDME
     {
         if (m_transformBuffer && m_context)
         {
-            m_context->UpdateBuffer(m_transformBuffer.get(), &m_transformData, sizeof(TransformCB));
+            m_context->UpdateBuffer(m_transformBuffer.get(), &m_transformData, sizeof(TransformConstants));
             m_context->SetConstantBuffer(EShaderStage::Vertex, 0, m_transformBuffer.get());
         }
     }